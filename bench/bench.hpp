@@ -0,0 +1,125 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace bench
+{
+/// @brief Prevents the compiler from optimizing away the computation of a value.
+template <typename T>
+inline void do_not_optimize(const T& value)
+{
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+struct result
+{
+    std::string name{};
+    double nanoseconds_per_iteration{};
+    std::size_t bytes_per_iteration{};
+
+    [[nodiscard]] double megabytes_per_second() const
+    {
+        return static_cast<double>(bytes_per_iteration) * 1e3 / nanoseconds_per_iteration;
+    }
+    /// @brief For the descriptor benchmarks an iteration processes a single descriptor.
+    [[nodiscard]] double iterations_per_second() const { return 1e9 / nanoseconds_per_iteration; }
+};
+
+enum class output_format
+{
+    TEXT,
+    JSON,
+};
+
+/// @brief The benchmark session's settings and the collected results.
+struct session
+{
+    output_format format{output_format::TEXT};
+    std::vector<result> results{};
+
+    static session& instance()
+    {
+        static session s;
+        return s;
+    }
+};
+
+/// @brief  Measures the average duration of a function call, repeating it for a minimum time.
+/// @param  name: the benchmark's name
+/// @param  bytes_per_iteration: the amount of input data processed by a single call
+/// @param  func: the function to measure
+template <typename TFunc>
+result measure(std::string name, std::size_t bytes_per_iteration, TFunc&& func)
+{
+    using clock = std::chrono::steady_clock;
+    constexpr auto min_duration = std::chrono::milliseconds(200);
+
+    func(); // warm-up
+    std::size_t iterations = 1;
+    while (true)
+    {
+        auto start = clock::now();
+        for (std::size_t i = 0; i < iterations; ++i)
+        {
+            func();
+        }
+        auto elapsed = clock::now() - start;
+        if (elapsed >= min_duration)
+        {
+            return {std::move(name),
+                    std::chrono::duration<double, std::nano>(elapsed).count() /
+                        static_cast<double>(iterations),
+                    bytes_per_iteration};
+        }
+        iterations *= 2;
+    }
+}
+
+/// @brief Records the result, and prints it right away in text output mode.
+inline void print(result res)
+{
+    auto& s = session::instance();
+    if (s.format == output_format::TEXT)
+    {
+        std::printf("%-56s %12.1f ns %10.1f MB/s %12.0f /s\n", res.name.c_str(),
+                    res.nanoseconds_per_iteration, res.megabytes_per_second(),
+                    res.iterations_per_second());
+    }
+    s.results.push_back(std::move(res));
+}
+
+/// @brief Writes all recorded results as a JSON document, for regression tracking.
+inline void write_json(std::FILE* out)
+{
+    const auto& results = session::instance().results;
+    std::fprintf(out, "{\n  \"context\": {\n");
+#if defined(__VERSION__)
+    std::fprintf(out, "    \"compiler\": \"%s\",\n", __VERSION__);
+#endif
+    std::fprintf(out, "    \"cplusplus\": %ld\n  },\n  \"benchmarks\": [", __cplusplus);
+    for (std::size_t i = 0; i < results.size(); ++i)
+    {
+        const auto& res = results[i];
+        std::fprintf(out,
+                     "%s\n    {\"name\": \"%s\", \"ns_per_iteration\": %.3f, "
+                     "\"bytes_per_iteration\": %zu, \"mb_per_second\": %.3f, "
+                     "\"iterations_per_second\": %.3f}",
+                     (i == 0) ? "" : ",", res.name.c_str(), res.nanoseconds_per_iteration,
+                     res.bytes_per_iteration, res.megabytes_per_second(),
+                     res.iterations_per_second());
+    }
+    std::fprintf(out, "\n  ]\n}\n");
+}
+
+void bit_field_benchmarks();
+void descriptor_parsing_benchmarks();
+void formatter_benchmarks();
+void parser_dispatch_benchmarks();
+void report_batch_benchmarks();
+void report_field_benchmarks();
+
+} // namespace bench
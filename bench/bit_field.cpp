@@ -0,0 +1,41 @@
+#include <random>
+#include <vector>
+#include "bench.hpp"
+#include "hid/bit_field.hpp"
+
+namespace
+{
+void compare(const char* scalar_name, const char* kernel_name, hid::bit_field_array array)
+{
+    std::vector<std::uint8_t> data((array.bit_end() + 7) / 8);
+    std::mt19937 rng(static_cast<unsigned>(array.bit_size));
+    for (auto& byte : data)
+    {
+        byte = static_cast<std::uint8_t>(rng());
+    }
+    std::vector<std::int32_t> values(array.count);
+
+    bench::print(bench::measure(scalar_name, data.size(), [&]() {
+        for (std::size_t i = 0; i < array.count; ++i)
+        {
+            auto raw = hid::extract_bits(data, array.element_bit_offset(i), array.bit_size);
+            values[i] = array.is_signed ? hid::sign_extend(raw, array.bit_size)
+                                        : static_cast<std::int32_t>(raw);
+        }
+        bench::do_not_optimize(values.front());
+    }));
+    bench::print(bench::measure(kernel_name, data.size(), [&]() {
+        hid::extract(data, array, values);
+        bench::do_not_optimize(values.front());
+    }));
+}
+} // namespace
+
+void bench::bit_field_benchmarks()
+{
+    constexpr std::size_t count = 4096;
+    compare("bit_field/1bit/scalar", "bit_field/1bit/kernel", {0, 1, 1, count, false});
+    compare("bit_field/8bit/scalar", "bit_field/8bit/kernel", {0, 8, 8, count, true});
+    compare("bit_field/16bit/scalar", "bit_field/16bit/kernel", {0, 16, 16, count, true});
+    compare("bit_field/12bit/scalar", "bit_field/12bit/kernel", {4, 12, 12, count, true});
+}
@@ -0,0 +1,77 @@
+// Translation unit probing the compile-time cost of the constexpr descriptor machinery.
+// It is compiled repeatedly by compile_cost.py, selecting the scenario with
+// COMPILE_COST_CASE and its size with COMPILE_COST_SIZE.
+#include <utility>
+#include "hid/app/keyboard.hpp"
+#include "hid/app/lamparray.hpp"
+#include "hid/app/mouse.hpp"
+#include "hid/report_protocol.hpp"
+
+#define COMPILE_COST_LAMP_MULTI_UPDATE 1
+#define COMPILE_COST_COMPOSITE 2
+
+#if !defined(COMPILE_COST_CASE) || !defined(COMPILE_COST_SIZE)
+#error "COMPILE_COST_CASE and COMPILE_COST_SIZE must be defined"
+#endif
+
+namespace
+{
+constexpr std::size_t size = COMPILE_COST_SIZE;
+
+#if COMPILE_COST_CASE == COMPILE_COST_LAMP_MULTI_UPDATE
+
+/// @brief A single lamp multi update report, with a MAX_LAMP_COUNT of size.
+constexpr auto make_descriptor()
+{
+    using namespace hid::app::lamparray;
+    using namespace hid::rdf;
+    using lighting = hid::page::lighting_and_illumination;
+
+    return descriptor(usage_page<lighting>(), usage(lighting::LAMP_ARRAY),
+                      collection::application(lamp_multi_update_report_descriptor<1, size>()));
+}
+
+static_assert(
+    hid::report_protocol::from_descriptor<make_descriptor()>().feature_report_count == 1);
+
+#elif COMPILE_COST_CASE == COMPILE_COST_COMPOSITE
+
+/// @brief Top-level collections alternate between keyboard and mouse, each with its own report ID.
+template <std::size_t INDEX>
+constexpr auto make_tlc()
+{
+    constexpr auto report_id = static_cast<std::uint8_t>(INDEX + 1);
+    if constexpr ((INDEX % 2) == 0)
+    {
+        return hid::app::keyboard::app_report_descriptor<report_id>();
+    }
+    else
+    {
+        return hid::app::mouse::app_report_descriptor<report_id>();
+    }
+}
+
+/// @brief A composite descriptor made of size top-level collections.
+constexpr auto make_descriptor()
+{
+    static_assert(size <= 255);
+    return []<std::size_t... I>(std::index_sequence<I...>)
+    {
+        return hid::rdf::descriptor(make_tlc<I>()...);
+    }(std::make_index_sequence<size>());
+}
+
+static_assert(
+    hid::report_protocol::from_descriptor<make_descriptor()>().input_report_count == size);
+
+#else
+#error "unknown COMPILE_COST_CASE"
+#endif
+
+constexpr auto properties_table = hid::make_report_properties_table<make_descriptor()>();
+} // namespace
+
+int main()
+{
+    return static_cast<int>(properties_table.size() == 0);
+}
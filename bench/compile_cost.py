@@ -0,0 +1,83 @@
+#!/usr/bin/env python3
+"""Measures the compile time and peak compiler memory of descriptors with growing size.
+
+Each case compiles compile_cost.cpp with a different COMPILE_COST_CASE and COMPILE_COST_SIZE,
+so that regressions in the constexpr descriptor machinery become visible.
+Usage: compile_cost.py --compiler CXX [-I DIR]... [--flag FLAG]... [--json] [--repeat N]
+"""
+
+import argparse
+import json
+import os
+import subprocess
+import sys
+import tempfile
+import time
+
+CASES = [
+    # (name, COMPILE_COST_CASE, sizes)
+    ("lamp_multi_update_report", 1, [8, 32, 64, 127]),
+    ("composite_tlcs", 2, [1, 4, 16, 64]),
+]
+
+
+def measure(args, case, size, output, log):
+    """Compiles a single case, returns the best time and the peak memory of all repetitions."""
+    command = [args.compiler, "-std=gnu++20", *args.flag]
+    command += ["-I" + d for d in args.include_dir]
+    command += ["-DCOMPILE_COST_CASE=%d" % case, "-DCOMPILE_COST_SIZE=%d" % size]
+    command += ["-c", args.source, "-o", output]
+    best_time = None
+    peak_kib = 0
+    for _ in range(args.repeat):
+        start = time.perf_counter()
+        with open(log, "w+") as diagnostics:
+            process = subprocess.Popen(command, stdout=diagnostics, stderr=diagnostics)
+            # wait4() reports the resource usage of this compiler invocation alone
+            _, status, usage = os.wait4(process.pid, 0)
+            elapsed = time.perf_counter() - start
+            if status != 0:
+                diagnostics.seek(0)
+                sys.stderr.write(diagnostics.read())
+                raise RuntimeError("compilation failed: " + " ".join(command))
+        best_time = elapsed if best_time is None else min(best_time, elapsed)
+        peak_kib = max(peak_kib, usage.ru_maxrss)
+    return best_time, peak_kib
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--compiler", required=True, help="C++ compiler executable")
+    parser.add_argument("-I", dest="include_dir", action="append", default=[],
+                        help="include directory")
+    parser.add_argument("--flag", action="append", default=[],
+                        help="additional compiler flag")
+    parser.add_argument("--source", default=os.path.join(os.path.dirname(__file__),
+                                                         "compile_cost.cpp"))
+    parser.add_argument("--repeat", type=int, default=1,
+                        help="compile each case N times, report the fastest")
+    parser.add_argument("--json", action="store_true", help="write the results as JSON")
+    args = parser.parse_args()
+
+    results = []
+    with tempfile.TemporaryDirectory() as tmp:
+        output = os.path.join(tmp, "compile_cost.o")
+        log = os.path.join(tmp, "compile_cost.log")
+        for name, case, sizes in CASES:
+            for size in sizes:
+                seconds, peak_kib = measure(args, case, size, output, log)
+                results.append({"name": "%s/%d" % (name, size), "seconds": round(seconds, 3),
+                                "peak_memory_kib": peak_kib})
+                if not args.json:
+                    print("%-40s %9.3f s %10.1f MiB" % (results[-1]["name"], seconds,
+                                                        peak_kib / 1024), flush=True)
+
+    if args.json:
+        context = {"compiler": args.compiler, "flags": args.flag}
+        json.dump({"context": context, "benchmarks": results}, sys.stdout, indent=2)
+        print()
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
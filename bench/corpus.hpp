@@ -0,0 +1,102 @@
+#pragma once
+
+#include <span>
+#include <utility>
+#include <vector>
+#include "hid/descriptor_generator.hpp"
+#include "hid/app/keyboard.hpp"
+#include "hid/app/lamparray.hpp"
+#include "hid/app/mouse.hpp"
+
+namespace bench
+{
+namespace corpus
+{
+constexpr auto keyboard = hid::app::keyboard::app_report_descriptor<0>();
+constexpr auto mouse = hid::app::mouse::app_report_descriptor<0>();
+
+template <std::uint8_t FIRST_ID>
+constexpr auto lamparray_descriptor()
+{
+    using namespace hid::app::lamparray;
+
+    // clang-format off
+    return hid::rdf::descriptor(
+        hid::rdf::usage_page<hid::page::lighting_and_illumination>(),
+        hid::rdf::usage(hid::page::lighting_and_illumination::LAMP_ARRAY),
+        hid::rdf::collection::application(
+            lamp_array_attributes_report_descriptor<FIRST_ID>(),
+            lamp_attributes_request_report_descriptor<FIRST_ID + 1>(),
+            lamp_attributes_response_report_descriptor<FIRST_ID + 2>(),
+            lamp_multi_update_report_descriptor<FIRST_ID + 3, 10>(),
+            lamp_range_update_report_descriptor<FIRST_ID + 4>(),
+            control_report_descriptor<FIRST_ID + 5>()
+        )
+    );
+    // clang-format on
+}
+
+constexpr auto lamparray = lamparray_descriptor<1>();
+constexpr auto composite = hid::rdf::descriptor(hid::app::keyboard::app_report_descriptor<1>(),
+                                                hid::app::mouse::app_report_descriptor<2>(),
+                                                lamparray_descriptor<3>());
+
+/// @brief Synthetically scaled descriptor, made of multiple lamp array collections,
+///        each with its own range of report IDs.
+template <std::size_t COUNT>
+constexpr auto scaled_descriptor()
+{
+    constexpr std::size_t ids_per_lamparray = 6;
+    static_assert((COUNT * ids_per_lamparray) <= 255);
+    return []<std::size_t... I>(std::index_sequence<I...>)
+    {
+        return hid::rdf::descriptor(
+            lamparray_descriptor<static_cast<std::uint8_t>(1 + I * ids_per_lamparray)>()...);
+    }(std::make_index_sequence<COUNT>());
+}
+
+constexpr auto scaled_x4 = scaled_descriptor<4>();
+constexpr auto scaled_x16 = scaled_descriptor<16>();
+constexpr auto scaled_x32 = scaled_descriptor<32>();
+} // namespace corpus
+
+struct corpus_entry
+{
+    const char* name;
+    std::span<const hid::rdf::byte_type> data;
+};
+
+inline constexpr std::array<corpus_entry, 7> descriptors{{
+    {"keyboard", corpus::keyboard},
+    {"mouse", corpus::mouse},
+    {"lamparray", corpus::lamparray},
+    {"composite", corpus::composite},
+    {"scaled_x4", corpus::scaled_x4},
+    {"scaled_x16", corpus::scaled_x16},
+    {"scaled_x32", corpus::scaled_x32},
+}};
+
+/// @brief Randomly generated large descriptors, for measuring the parsing latency at scale.
+inline const std::array<corpus_entry, 3>& generated_descriptors()
+{
+    static const auto generate = [](std::size_t size)
+    {
+        return hid::descriptor_generator({.tlc_count = 8,
+                                          .nesting_depth = 3,
+                                          .report_id_count = 255,
+                                          .target_size = size,
+                                          .max_report_size = 1024,
+                                          .push_pop = true})
+            .generate();
+    };
+    static const std::array<std::vector<hid::rdf::byte_type>, 3> data{
+        generate(4 * 1024), generate(64 * 1024), generate(1024 * 1024)};
+    static const std::array<corpus_entry, 3> entries{{
+        {"generated_4k", data[0]},
+        {"generated_64k", data[1]},
+        {"generated_1m", data[2]},
+    }};
+    return entries;
+}
+
+} // namespace bench
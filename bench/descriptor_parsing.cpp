@@ -0,0 +1,78 @@
+#include <string>
+#include "bench.hpp"
+#include "corpus.hpp"
+#include "hid/report_protocol.hpp"
+
+using namespace hid::rdf;
+
+namespace
+{
+/// @brief Minimal parser that visits every report data field, to measure the item walk itself.
+template <typename TIterator>
+struct field_counting_parser : public parser<TIterator>
+{
+    using base = parser<TIterator>;
+    using control = base::control;
+    using item_type = base::item_type;
+    using items_view_type = base::items_view_type;
+
+    field_counting_parser(const descriptor_view_base<TIterator>& desc_view)
+    {
+        base::parse_items(desc_view);
+    }
+
+    control parse_report_data_field([[maybe_unused]] const item_type& main_item,
+                                    const global_item_store& global_state,
+                                    [[maybe_unused]] const items_view_type& main_section,
+                                    [[maybe_unused]] unsigned tlc_number) override
+    {
+        auto params = base::get_report_data_field_params(global_state);
+        bit_count_ += params.size * params.count;
+        return control::CONTINUE;
+    }
+
+    std::size_t bit_count_{};
+};
+
+template <typename TIterator>
+void descriptor_parsing_benchmarks(const char* iterator_name, const bench::corpus_entry& entry)
+{
+    auto desc_view = descriptor_view_base<TIterator>(entry.data.data(), entry.data.size());
+    auto suffix = std::string("/") + iterator_name + "/" + entry.name;
+
+    bench::print(bench::measure("rdf::parser" + suffix, entry.data.size(),
+                                [&]()
+                                {
+                                    field_counting_parser<TIterator> parser(desc_view);
+                                    bench::do_not_optimize(parser.bit_count_);
+                                }));
+    bench::print(bench::measure("report_protocol::parser" + suffix, entry.data.size(),
+                                [&]()
+                                {
+                                    hid::report_protocol::parser<TIterator> parser(desc_view);
+                                    bench::do_not_optimize(parser.max_report_id());
+                                }));
+    bench::print(bench::measure(
+        "get_application_usage_id" + suffix, entry.data.size(),
+        [&]() { bench::do_not_optimize(get_application_usage_id(desc_view)); }));
+}
+
+template <typename TIterator>
+void descriptor_parsing_benchmarks(const char* iterator_name)
+{
+    for (const auto& entry : bench::descriptors)
+    {
+        descriptor_parsing_benchmarks<TIterator>(iterator_name, entry);
+    }
+    for (const auto& entry : bench::generated_descriptors())
+    {
+        descriptor_parsing_benchmarks<TIterator>(iterator_name, entry);
+    }
+}
+} // namespace
+
+void bench::descriptor_parsing_benchmarks()
+{
+    ::descriptor_parsing_benchmarks<reinterpret_iterator>("reinterpret_iterator");
+    ::descriptor_parsing_benchmarks<copy_iterator>("copy_iterator");
+}
@@ -0,0 +1,35 @@
+#include <iterator>
+#include <string>
+#include "bench.hpp"
+#include "corpus.hpp"
+#include "hid/rdf/formatter.hpp"
+
+using namespace hid::rdf;
+
+namespace
+{
+template <typename TIterator>
+void formatter_benchmarks(const char* iterator_name)
+{
+    std::string out;
+    for (const auto& entry : bench::descriptors)
+    {
+        auto desc_view = descriptor_view_base<TIterator>(entry.data.data(), entry.data.size());
+        bench::print(bench::measure(std::string("std::formatter<descriptor_view>/") +
+                                        iterator_name + "/" + entry.name,
+                                    entry.data.size(),
+                                    [&]()
+                                    {
+                                        out.clear();
+                                        std::format_to(std::back_inserter(out), "{}", desc_view);
+                                        bench::do_not_optimize(out.data());
+                                    }));
+    }
+}
+} // namespace
+
+void bench::formatter_benchmarks()
+{
+    ::formatter_benchmarks<reinterpret_iterator>("reinterpret_iterator");
+    ::formatter_benchmarks<copy_iterator>("copy_iterator");
+}
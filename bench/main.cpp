@@ -0,0 +1,35 @@
+#include <cstring>
+#include "bench.hpp"
+
+/// @brief Runs all benchmarks.
+///        Usage: hid-rp-bench [--json]
+///        With --json the results are written to the standard output as a JSON document,
+///        for tracking the performance across releases.
+int main(int argc, char* argv[])
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "--json") == 0)
+        {
+            bench::session::instance().format = bench::output_format::JSON;
+        }
+        else
+        {
+            std::fprintf(stderr, "usage: %s [--json]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    bench::bit_field_benchmarks();
+    bench::descriptor_parsing_benchmarks();
+    bench::formatter_benchmarks();
+    bench::parser_dispatch_benchmarks();
+    bench::report_batch_benchmarks();
+    bench::report_field_benchmarks();
+
+    if (bench::session::instance().format == bench::output_format::JSON)
+    {
+        bench::write_json(stdout);
+    }
+    return 0;
+}
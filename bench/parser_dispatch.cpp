@@ -0,0 +1,111 @@
+#include <string>
+#include "bench.hpp"
+#include "corpus.hpp"
+#include "virtual_dispatch.hpp"
+
+using namespace hid::rdf;
+
+namespace
+{
+/// @brief The virtual dispatch baseline of @ref hid::rdf::get_application_usage_id,
+///        as it was implemented on top of the virtual @ref hid::rdf::parser.
+struct application_usage_id_parser final : public parser<reinterpret_iterator>
+{
+    using base = parser<reinterpret_iterator>;
+
+    application_usage_id_parser() = default;
+
+    control parse_collection_begin([[maybe_unused]] main::collection_type collection,
+                                   const global_item_store& global_state,
+                                   const items_view_type& main_section,
+                                   [[maybe_unused]] unsigned tlc_number) override
+    {
+        collection_depth_++;
+        if (collection_depth_ == 1)
+        {
+            for (auto& it : main_section)
+            {
+                if (it.has_tag(tag::USAGE))
+                {
+                    usage_ = base::get_usage(it, global_state);
+                    break;
+                }
+            }
+        }
+        return control::CONTINUE;
+    }
+    control parse_collection_end([[maybe_unused]] const global_item_store& global_state,
+                                 [[maybe_unused]] const items_view_type& main_section,
+                                 [[maybe_unused]] unsigned tlc_number) override
+    {
+        collection_depth_--;
+        return (collection_depth_ == 0) ? control::BREAK : control::CONTINUE;
+    }
+
+    hid::usage_t usage_{hid::nullusage};
+    unsigned collection_depth_{};
+};
+
+hid::usage_t virtual_get_application_usage_id(const descriptor_view& desc_view)
+{
+    application_usage_id_parser parser;
+    bench::parse_dynamic(parser, desc_view);
+    return parser.usage_;
+}
+
+/// @brief The handlers of the virtual dispatch baseline forward to the static ones.
+class report_protocol_handlers final : public bench::virtual_report_protocol_parser
+{
+  public:
+    report_protocol_handlers() = default;
+
+  protected:
+    control parse_collection_begin(main::collection_type collection,
+                                   const global_item_store& global_state,
+                                   const items_view_type& main_section,
+                                   unsigned tlc_number) override
+    {
+        return base::parse_collection_begin(collection, global_state, main_section, tlc_number);
+    }
+    control parse_collection_end(const global_item_store& global_state,
+                                 const items_view_type& main_section,
+                                 unsigned tlc_number) override
+    {
+        return base::parse_collection_end(global_state, main_section, tlc_number);
+    }
+    control parse_report_data_field(const item_type& main_item,
+                                    const global_item_store& global_state,
+                                    const items_view_type& main_section,
+                                    unsigned tlc_number) override
+    {
+        return base::parse_report_data_field(main_item, global_state, main_section, tlc_number);
+    }
+};
+} // namespace
+
+void bench::parser_dispatch_benchmarks()
+{
+    for (const auto& entry : descriptors)
+    {
+        auto desc_view = descriptor_view(entry.data.data(), entry.data.size());
+        auto name = std::string(entry.name);
+
+        print(measure("get_application_usage_id/virtual/" + name, entry.data.size(),
+                      [&]() { do_not_optimize(virtual_get_application_usage_id(desc_view)); }));
+        print(measure("get_application_usage_id/static/" + name, entry.data.size(),
+                      [&]() { do_not_optimize(get_application_usage_id(desc_view)); }));
+        print(measure("report_protocol::parser/virtual/" + name, entry.data.size(),
+                      [&]()
+                      {
+                          report_protocol_handlers parser;
+                          bench::parse_dynamic(parser, desc_view);
+                          do_not_optimize(parser.max_report_id());
+                      }));
+        print(measure("report_protocol::parser/static/" + name, entry.data.size(),
+                      [&]()
+                      {
+                          hid::report_protocol::parser<reinterpret_iterator> parser(desc_view);
+                          do_not_optimize(parser.max_report_id());
+                      }));
+    }
+}
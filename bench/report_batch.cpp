@@ -0,0 +1,92 @@
+#include <random>
+#include <vector>
+#include "bench.hpp"
+#include "hid/app/mouse.hpp"
+#include "hid/report_batch.hpp"
+
+using namespace hid::page;
+
+namespace
+{
+// clang-format off
+constexpr auto digitizer_desc = hid::rdf::descriptor(
+    hid::rdf::usage_page<generic_desktop>(),
+    hid::rdf::usage(generic_desktop::JOYSTICK),
+    hid::rdf::collection::application(
+        hid::rdf::report_id(1),
+        hid::rdf::usage_extended_limits(generic_desktop::X, generic_desktop::RZ),
+        hid::rdf::logical_limits<2, 2>(-2048, 2047),
+        hid::rdf::report_size(12),
+        hid::rdf::report_count(6),
+        hid::rdf::input::absolute_variable(),
+        hid::rdf::usage_page<button>(),
+        hid::rdf::usage_limits(button(1), button(16)),
+        hid::rdf::logical_limits<1, 1>(0, 1),
+        hid::rdf::report_size(1),
+        hid::rdf::report_count(16),
+        hid::rdf::input::absolute_variable()
+    )
+);
+// clang-format on
+
+/// @brief The baseline: decoding the reports one by one, field by field.
+void scalar_decode(hid::report_layout::fields_view fields, std::span<const std::uint8_t> reports,
+                   std::size_t stride, std::span<std::int32_t> values)
+{
+    auto value = values.begin();
+    for (std::size_t offset = 0; offset + stride <= reports.size(); offset += stride)
+    {
+        auto report = reports.subspan(offset, stride);
+        for (const auto& field : fields)
+        {
+            if (field.is_padding())
+            {
+                continue;
+            }
+            for (std::size_t i = 0; i < field.count; ++i)
+            {
+                auto raw = hid::extract_bits(report, field.element_bit_offset(i), field.bit_size);
+                *value++ = field.is_signed() ? hid::sign_extend(raw, field.bit_size)
+                                             : static_cast<std::int32_t>(raw);
+            }
+        }
+    }
+}
+
+void compare(const char* scalar_name, const char* batch_name,
+             hid::report_layout::fields_view fields, std::size_t report_count)
+{
+    const auto decoder = hid::report_batch_decoder(fields);
+    const auto stride = decoder.report_size();
+    std::vector<std::uint8_t> reports(report_count * stride);
+    std::mt19937 rng(report_count);
+    for (auto& byte : reports)
+    {
+        byte = static_cast<std::uint8_t>(rng());
+    }
+    std::vector<std::int32_t> values(report_count * decoder.column_count());
+
+    bench::print(bench::measure(scalar_name, reports.size(), [&]() {
+        scalar_decode(fields, reports, stride, values);
+        bench::do_not_optimize(values.front());
+    }));
+    bench::print(bench::measure(batch_name, reports.size(), [&]() {
+        decoder.decode(reports, stride, values);
+        bench::do_not_optimize(values.front());
+    }));
+}
+} // namespace
+
+void bench::report_batch_benchmarks()
+{
+    static constexpr auto mouse_layout =
+        hid::report_layout(hid::report_layout_table<hid::app::mouse::app_report_descriptor<0>()>);
+    static constexpr auto digitizer_layout =
+        hid::report_layout(hid::report_layout_table<digitizer_desc>);
+    constexpr std::size_t report_count = 4096;
+
+    compare("report_batch/mouse/scalar", "report_batch/mouse/batch",
+            mouse_layout.fields(hid::app::mouse::report<0>::selector()), report_count);
+    compare("report_batch/12bit_axes/scalar", "report_batch/12bit_axes/batch",
+            digitizer_layout.fields(), report_count);
+}
@@ -0,0 +1,68 @@
+#include <array>
+#include "bench.hpp"
+#include "hid/app/keyboard.hpp"
+
+using namespace hid::page;
+
+namespace
+{
+/// @brief A typing sequence, with each key pressed and released in turn, with some overlap.
+constexpr auto key_sequence = []()
+{
+    std::array<keyboard_keypad, 32> keys{};
+    for (std::size_t i = 0; i < keys.size(); ++i)
+    {
+        keys[i] = static_cast<keyboard_keypad>(
+            static_cast<std::size_t>(keyboard_keypad::KEYBOARD_A) + (i * 7) % 96);
+    }
+    return keys;
+}();
+
+template <typename TField>
+void type_sequence(TField& field)
+{
+    for (std::size_t i = 0; i < key_sequence.size(); ++i)
+    {
+        field.set(key_sequence[i]);
+        if (i > 0)
+        {
+            field.reset(key_sequence[i - 1]);
+        }
+        bench::do_not_optimize(field.test(key_sequence[i]));
+    }
+    field.reset();
+}
+} // namespace
+
+void bench::report_field_benchmarks()
+{
+    // NKRO style keyboard report field
+    hid::report_bitset<keyboard_keypad, keyboard_keypad::KEYBOARD_A,
+                       keyboard_keypad::KEYPAD_HEXADECIMAL>
+        bitset;
+    print(measure("report_bitset/set+reset+test", sizeof(bitset),
+                  [&]()
+                  {
+                      type_sequence(bitset);
+                      do_not_optimize(bitset);
+                  }));
+
+    // boot protocol style keyboard report field
+    hid::report_array<keyboard_keypad, 6> array;
+    print(measure("report_array/set+reset+test", sizeof(array),
+                  [&]()
+                  {
+                      type_sequence(array);
+                      do_not_optimize(array);
+                  }));
+
+    hid::app::keyboard::keys_input_report<0> report;
+    print(measure("keys_input_report/modifiers+scancodes", sizeof(report),
+                  [&]()
+                  {
+                      report.modifiers.set(keyboard_keypad::KEYBOARD_LEFT_SHIFT);
+                      type_sequence(report.scancodes);
+                      report.modifiers.reset(keyboard_keypad::KEYBOARD_LEFT_SHIFT);
+                      do_not_optimize(report);
+                  }));
+}
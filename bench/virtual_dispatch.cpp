@@ -0,0 +1,13 @@
+#include "virtual_dispatch.hpp"
+
+void bench::parse_dynamic(hid::rdf::parser<hid::rdf::reinterpret_iterator>& parser,
+                          const hid::rdf::descriptor_view& desc_view)
+{
+    parser.parse_items(desc_view);
+}
+
+void bench::parse_dynamic(virtual_report_protocol_parser& parser,
+                          const hid::rdf::descriptor_view& desc_view)
+{
+    parser.parse(desc_view);
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "hid/report_protocol.hpp"
+
+namespace bench
+{
+/// @brief The virtual dispatch baseline of @ref hid::report_protocol::parser:
+///        the static parser reaches each handler through a virtual call.
+///        The handlers are implemented by a subclass, which is unknown to @ref parse_dynamic.
+class virtual_report_protocol_parser
+    : public hid::report_protocol::parser<hid::rdf::reinterpret_iterator,
+                                          virtual_report_protocol_parser>
+{
+    friend hid::rdf::static_parser<virtual_report_protocol_parser,
+                                   hid::rdf::reinterpret_iterator>;
+
+  public:
+    using base = hid::report_protocol::parser<hid::rdf::reinterpret_iterator,
+                                              virtual_report_protocol_parser>;
+
+    virtual ~virtual_report_protocol_parser() = default;
+
+    virtual_report_protocol_parser(const virtual_report_protocol_parser&) = delete;
+    virtual_report_protocol_parser& operator=(const virtual_report_protocol_parser&) = delete;
+    virtual_report_protocol_parser(virtual_report_protocol_parser&&) = delete;
+    virtual_report_protocol_parser& operator=(virtual_report_protocol_parser&&) = delete;
+
+    void parse(const hid::rdf::descriptor_view& desc_view) { base::parse(desc_view); }
+
+  protected:
+    virtual_report_protocol_parser() = default;
+
+    virtual control parse_collection_begin(hid::rdf::main::collection_type collection,
+                                           const hid::rdf::global_item_store& global_state,
+                                           const items_view_type& main_section,
+                                           unsigned tlc_number) = 0;
+    virtual control parse_collection_end(const hid::rdf::global_item_store& global_state,
+                                         const items_view_type& main_section,
+                                         unsigned tlc_number) = 0;
+    virtual control parse_report_data_field(const item_type& main_item,
+                                            const hid::rdf::global_item_store& global_state,
+                                            const items_view_type& main_section,
+                                            unsigned tlc_number) = 0;
+};
+
+/// @brief These functions parse the descriptor through a base class reference, in a separate
+///        translation unit, so the compiler can't see the parser's dynamic type,
+///        and has to dispatch the handlers virtually.
+void parse_dynamic(hid::rdf::parser<hid::rdf::reinterpret_iterator>& parser,
+                   const hid::rdf::descriptor_view& desc_view);
+void parse_dynamic(virtual_report_protocol_parser& parser,
+                   const hid::rdf::descriptor_view& desc_view);
+
+} // namespace bench
@@ -1,12 +1,158 @@
+#include <charconv>
 #include <fstream>
 #include <iostream>
 #include <iterator>
+#include <limits>
+#include <optional>
+#include <string_view>
+#include <type_traits>
 #include <vector>
+#include "hid/descriptor_generator.hpp"
 #include "hid/rdf/formatter.hpp"
 
+namespace
+{
+void print_usage(const char* program)
+{
+    std::cerr << "Usage: " << program << " [FILE]\n"
+              << "       " << program << " --generate [OPTIONS]\n"
+              << "Prints the binary file or std input as human readable HID report descriptor,\n"
+              << "or writes a random, but valid binary HID report descriptor to std output.\n"
+              << "Generator options:\n"
+              << "  --seed N         random seed\n"
+              << "  --tlcs N         number of top-level collections (1-255)\n"
+              << "  --depth N        max collection nesting depth\n"
+              << "  --report-ids N   number of report IDs (0-255)\n"
+              << "  --fields N       number of report data fields per top-level collection\n"
+              << "  --size N         minimum descriptor size, overrides --fields\n"
+              << "                   (limited by the number of report IDs and the report size)\n"
+              << "  --report-size N  max report size in bytes (1-8191)\n"
+              << "  --push-pop       use PUSH and POP items\n"
+              << "  --data-size minimal|random|maximal  item data size encoding\n";
+}
+
+/// @brief  Parses a decimal option value.
+/// @return The value, or nothing if the whole string isn't a number in the [min, max] range
+std::optional<std::uint64_t> parse_number(std::string_view value, std::uint64_t min,
+                                          std::uint64_t max)
+{
+    std::uint64_t number{};
+    const auto* end = value.data() + value.size();
+    auto [ptr, error] = std::from_chars(value.data(), end, number);
+    if ((error != std::errc()) or (ptr != end) or (number < min) or (number > max))
+    {
+        return std::nullopt;
+    }
+    return number;
+}
+
+int generate(int argc, char* argv[])
+{
+    using generator = hid::descriptor_generator;
+    generator::config config{};
+    for (int i = 2; i < argc; ++i)
+    {
+        std::string_view option = argv[i];
+        if (option == "--push-pop")
+        {
+            config.push_pop = true;
+            continue;
+        }
+        if ((i + 1) >= argc)
+        {
+            print_usage(argv[0]);
+            return 1;
+        }
+        std::string_view value = argv[++i];
+        if (option == "--data-size")
+        {
+            if (value == "minimal")
+            {
+                config.data_sizes = generator::data_size_policy::MINIMAL;
+            }
+            else if (value == "random")
+            {
+                config.data_sizes = generator::data_size_policy::RANDOM;
+            }
+            else if (value == "maximal")
+            {
+                config.data_sizes = generator::data_size_policy::MAXIMAL;
+            }
+            else
+            {
+                print_usage(argv[0]);
+                return 1;
+            }
+            continue;
+        }
+        // the value is only parsed once the option is known, with the option's own range
+        auto set_number = [value](auto& field, std::uint64_t min, std::uint64_t max)
+        {
+            auto number = parse_number(value, min, max);
+            if (number)
+            {
+                field = static_cast<std::remove_reference_t<decltype(field)>>(*number);
+            }
+            return number.has_value();
+        };
+        constexpr auto unsigned_max = std::uint64_t{std::numeric_limits<unsigned>::max()};
+        constexpr auto id_max = std::uint64_t{hid::report::id::max()};
+        bool valid = false;
+        if (option == "--seed")
+        {
+            valid = set_number(config.seed, 0, std::numeric_limits<std::uint64_t>::max());
+        }
+        else if (option == "--tlcs")
+        {
+            valid = set_number(config.tlc_count, 1, id_max);
+        }
+        else if (option == "--depth")
+        {
+            valid = set_number(config.nesting_depth, 1, unsigned_max);
+        }
+        else if (option == "--report-ids")
+        {
+            valid = set_number(config.report_id_count, 0, id_max);
+        }
+        else if (option == "--fields")
+        {
+            valid = set_number(config.fields_per_tlc, 0, unsigned_max);
+        }
+        else if (option == "--size")
+        {
+            valid = set_number(config.target_size, 0, std::numeric_limits<std::size_t>::max());
+        }
+        else if (option == "--report-size")
+        {
+            valid = set_number(config.max_report_size, 1, generator::max_report_size_limit);
+        }
+        if (!valid)
+        {
+            print_usage(argv[0]);
+            return 1;
+        }
+    }
+
+    auto desc = generator(config).generate();
+    std::cout.write(reinterpret_cast<const char*>(desc.data()),
+                    static_cast<std::streamsize>(desc.size()));
+    return 0;
+}
+} // namespace
+
 // print the binary file or std input as human readable HID report descriptor
 int main(int argc, char* argv[])
 {
+    if ((argc > 1) and (std::string_view(argv[1]) == "--generate"))
+    {
+        return generate(argc, argv);
+    }
+    if ((argc > 1) and (std::string_view(argv[1]).starts_with("-")))
+    {
+        print_usage(argv[0]);
+        return 1;
+    }
+
     std::vector<char> desc;
     if (argc > 1)
     {
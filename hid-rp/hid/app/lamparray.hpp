@@ -258,12 +258,12 @@ template <std::uint8_t REPORT_ID, std::size_t MAX_LAMP_COUNT, std::size_t LAMP_I
             usage(lighting::LAMP_ID),
             logical_limits<1, LAMP_ID_SIZE * 2>(0, std::numeric_limits<sized_unsigned_t<LAMP_ID_SIZE>>::max()),
             report_size(LAMP_ID_SIZE * 8),
-            report_count(MAX_LAMP_COUNT),
+            report_count<MAX_LAMP_COUNT>(),
             feature::absolute_variable(),
             rgbi_usages.repeat<MAX_LAMP_COUNT>(),
             logical_limits<1, 2>(0, 255),
             report_size(8),
-            report_count(MAX_LAMP_COUNT),
+            report_count<MAX_LAMP_COUNT * 4>(),
             feature::absolute_variable()
         )
     );
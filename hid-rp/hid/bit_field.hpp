@@ -0,0 +1,407 @@
+// SPDX-License-Identifier: MPL-2.0
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include "hid/rdf/exception.hpp"
+#if (defined(__x86_64__) or defined(__i386__)) and defined(__GNUC__)
+// the AVX2 kernel is compiled for AVX2 regardless of the target, and selected at runtime
+#define HID_RP_AVX2_DISPATCH 1
+#include <immintrin.h>
+#endif
+
+namespace hid
+{
+/// @brief  Creates a mask of the lowest bits.
+/// @param  bit_size: the number of set bits, at most 32
+[[nodiscard]] constexpr std::uint32_t bit_mask(std::size_t bit_size)
+{
+    return (bit_size >= 32) ? ~std::uint32_t() : ((std::uint32_t(1) << bit_size) - 1);
+}
+
+/// @brief  Interprets the lowest bits of a value as a two's complement number.
+/// @param  value: the raw bit field value
+/// @param  bit_size: the size of the bit field, between 1 and 32
+[[nodiscard]] constexpr std::int32_t sign_extend(std::uint32_t value, std::size_t bit_size)
+{
+    const auto unused_bits = static_cast<unsigned>(32 - bit_size);
+    return static_cast<std::int32_t>(value << unused_bits) >> unused_bits;
+}
+
+/// @brief  Reads an unsigned bit field from a little-endian byte buffer
+///         (the same byte order as @ref packed_integer and HID reports use).
+/// @param  data: the buffer, it must contain all bytes spanned by the field
+/// @param  bit_offset: the bit offset of the field's least significant bit
+/// @param  bit_size: the size of the field, between 1 and 32
+/// @return The field's value, zero extended
+[[nodiscard]] constexpr std::uint32_t extract_bits(std::span<const std::uint8_t> data,
+                                                   std::size_t bit_offset, std::size_t bit_size)
+{
+    const auto first_byte = bit_offset / 8;
+    const auto shift = bit_offset % 8;
+    const auto byte_count = (shift + bit_size + 7) / 8;
+    std::uint64_t raw = 0;
+    for (std::size_t i = 0; i < byte_count; ++i)
+    {
+        raw |= static_cast<std::uint64_t>(data[first_byte + i]) << (i * 8);
+    }
+    return static_cast<std::uint32_t>(raw >> shift) & bit_mask(bit_size);
+}
+
+/// @brief  Writes an unsigned bit field into a little-endian byte buffer,
+///         leaving the surrounding bits unchanged.
+/// @param  data: the buffer, it must contain all bytes spanned by the field
+/// @param  bit_offset: the bit offset of the field's least significant bit
+/// @param  bit_size: the size of the field, between 1 and 32
+/// @param  value: the value to write, truncated to the field size
+constexpr void insert_bits(std::span<std::uint8_t> data, std::size_t bit_offset,
+                           std::size_t bit_size, std::uint32_t value)
+{
+    const auto first_byte = bit_offset / 8;
+    const auto shift = bit_offset % 8;
+    const auto byte_count = (shift + bit_size + 7) / 8;
+    const auto mask = static_cast<std::uint64_t>(bit_mask(bit_size)) << shift;
+    const auto bits = (static_cast<std::uint64_t>(value) << shift) & mask;
+    for (std::size_t i = 0; i < byte_count; ++i)
+    {
+        auto& byte = data[first_byte + i];
+        byte = static_cast<std::uint8_t>((byte & ~(mask >> (i * 8))) | (bits >> (i * 8)));
+    }
+}
+
+/// @brief The shape of a bit field array's elements, which determines the kernel
+///        that is used for accessing them.
+enum class bit_field_shape : std::uint8_t
+{
+    BIT = 0,   ///< 1-bit elements, such as buttons
+    BYTE = 1,  ///< byte aligned 8-bit elements
+    WORD = 2,  ///< byte aligned 16-bit elements
+    DWORD = 4, ///< byte aligned 32-bit elements
+    SHIFTED,   ///< all elements have the same bit shift and byte count
+    UNALIGNED, ///< the elements have varying bit shifts
+};
+
+/// @brief This class describes an array of equally sized bit fields in a byte buffer.
+///        The elements are either consecutive (a report field's elements),
+///        or at a fixed byte distance (the same field in a batch of reports).
+struct bit_field_array
+{
+    std::size_t bit_offset{}; ///< the first element's bit offset
+    std::size_t bit_size{};   ///< the size of each element, between 1 and 32
+    std::size_t bit_stride{}; ///< the distance of consecutive elements' offsets in bits
+    std::size_t count{};
+    bool is_signed{};
+
+    [[nodiscard]] constexpr std::size_t element_bit_offset(std::size_t index) const
+    {
+        return bit_offset + index * bit_stride;
+    }
+
+    /// @brief The number of bits that the array spans in the buffer.
+    [[nodiscard]] constexpr std::size_t bit_end() const
+    {
+        return (count == 0) ? bit_offset : (element_bit_offset(count - 1) + bit_size);
+    }
+
+    [[nodiscard]] constexpr bit_field_shape shape() const
+    {
+        if (bit_size == 1)
+        {
+            return bit_field_shape::BIT;
+        }
+        if ((bit_stride % 8) != 0)
+        {
+            return bit_field_shape::UNALIGNED;
+        }
+        if ((bit_offset % 8) == 0)
+        {
+            switch (bit_size)
+            {
+            case 8:
+                return bit_field_shape::BYTE;
+            case 16:
+                return bit_field_shape::WORD;
+            case 32:
+                return bit_field_shape::DWORD;
+            default:
+                break;
+            }
+        }
+        return bit_field_shape::SHIFTED;
+    }
+
+    /// @brief The number of bytes that each element spans, when all elements have the same shift.
+    [[nodiscard]] constexpr std::size_t element_byte_count() const
+    {
+        return ((bit_offset % 8) + bit_size + 7) / 8;
+    }
+};
+
+/// @brief This class template contains the element access kernels of each bit field shape.
+///        On x86 targets, when the CPU supports AVX2 (checked at runtime), the extraction of
+///        byte strided arrays (such as the same field in a batch of reports) processes 8 elements
+///        at a time with gather loads. The remaining elements (and all elements on other CPUs)
+///        are extracted by the scalar loops, which have a fixed shift, mask and byte count
+///        wherever the shape allows it.
+/// @tparam SHAPE: the shape of the accessed elements
+/// @tparam BYTE_COUNT: the number of bytes spanned by each element, for the SHIFTED shape
+template <bit_field_shape SHAPE, std::size_t BYTE_COUNT = static_cast<std::size_t>(SHAPE)>
+struct bit_field_kernel
+{
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    static constexpr void extract(const std::uint8_t* data, const bit_field_array& array,
+                                  std::int32_t* values)
+    {
+        const auto sign_bits = array.is_signed ? static_cast<unsigned>(32 - array.bit_size) : 0U;
+        std::size_t first_scalar = 0;
+        if constexpr ((SHAPE != bit_field_shape::UNALIGNED) and (BYTE_COUNT <= 4))
+        {
+            if (!std::is_constant_evaluated())
+            {
+                first_scalar = extract_vector(data, array, values);
+            }
+        }
+        if constexpr (SHAPE == bit_field_shape::BIT)
+        {
+            for (std::size_t i = first_scalar; i < array.count; ++i)
+            {
+                const auto pos = array.element_bit_offset(i);
+                const auto value = static_cast<std::uint32_t>(data[pos / 8] >> (pos % 8)) & 1U;
+                values[i] = static_cast<std::int32_t>(value << sign_bits) >> sign_bits;
+            }
+        }
+        else if constexpr (SHAPE == bit_field_shape::UNALIGNED)
+        {
+            const auto bytes = std::span<const std::uint8_t>(data, (array.bit_end() + 7) / 8);
+            for (std::size_t i = 0; i < array.count; ++i)
+            {
+                const auto value =
+                    extract_bits(bytes, array.element_bit_offset(i), array.bit_size);
+                values[i] = static_cast<std::int32_t>(value << sign_bits) >> sign_bits;
+            }
+        }
+        else
+        {
+            const auto* first = data + (array.bit_offset / 8);
+            const auto byte_stride = array.bit_stride / 8;
+            const auto shift = array.bit_offset % 8;
+            const auto mask = bit_mask(array.bit_size);
+            for (std::size_t i = first_scalar; i < array.count; ++i)
+            {
+                const auto value =
+                    static_cast<std::uint32_t>(load(first + (i * byte_stride)) >> shift) & mask;
+                values[i] = static_cast<std::int32_t>(value << sign_bits) >> sign_bits;
+            }
+        }
+    }
+
+    static constexpr void insert(std::uint8_t* data, const bit_field_array& array,
+                                 const std::int32_t* values)
+    {
+        if constexpr ((SHAPE == bit_field_shape::BYTE) or (SHAPE == bit_field_shape::WORD) or
+                      (SHAPE == bit_field_shape::DWORD))
+        {
+            auto* first = data + (array.bit_offset / 8);
+            const auto byte_stride = array.bit_stride / 8;
+            for (std::size_t i = 0; i < array.count; ++i)
+            {
+                store(first + (i * byte_stride), static_cast<std::uint32_t>(values[i]));
+            }
+        }
+        else
+        {
+            const auto bytes = std::span<std::uint8_t>(data, (array.bit_end() + 7) / 8);
+            for (std::size_t i = 0; i < array.count; ++i)
+            {
+                insert_bits(bytes, array.element_bit_offset(i), array.bit_size,
+                            static_cast<std::uint32_t>(values[i]));
+            }
+        }
+    }
+
+  private:
+    /// @brief  Extracts the leading elements of a byte strided array with SIMD instructions,
+    ///         when the CPU supports them.
+    /// @return The number of extracted elements, the rest is left to the scalar loops
+    static std::size_t extract_vector([[maybe_unused]] const std::uint8_t* data,
+                                      [[maybe_unused]] const bit_field_array& array,
+                                      [[maybe_unused]] std::int32_t* values)
+    {
+#if defined(HID_RP_AVX2_DISPATCH)
+        static const bool avx2_supported = []()
+        {
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("avx2") != 0;
+        }();
+        if (avx2_supported)
+        {
+            return extract_avx2(data, array, values);
+        }
+#endif
+        return 0;
+    }
+
+#if defined(HID_RP_AVX2_DISPATCH)
+    /// @brief  Extracts the leading elements of a byte strided array 8 elements at a time,
+    ///         each loaded as a 32-bit word.
+    /// @return The number of extracted elements
+    __attribute__((target("avx2"))) static std::size_t
+    extract_avx2(const std::uint8_t* data, const bit_field_array& array, std::int32_t* values)
+    {
+        constexpr std::size_t LANES = 8;
+        const auto byte_stride = array.bit_stride / 8;
+        const auto first_byte = array.bit_offset / 8;
+        const auto end_byte = (array.bit_end() + 7) / 8;
+        if (((array.bit_stride % 8) != 0) or (array.element_byte_count() > 4) or
+            (byte_stride == 0) or
+            (byte_stride > (std::numeric_limits<std::int32_t>::max() / LANES)) or
+            ((first_byte + 4) > end_byte))
+        {
+            return 0;
+        }
+        // the 4 byte loads must not reach beyond the array's last byte
+        const auto load_count =
+            std::min(array.count, ((end_byte - first_byte - 4) / byte_stride) + 1);
+        const auto vector_count = load_count - (load_count % LANES);
+
+        const auto stride = static_cast<std::int32_t>(byte_stride);
+        const __m256i lane_offsets = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7),
+                                                        _mm256_set1_epi32(stride));
+        const __m128i shift = _mm_cvtsi32_si128(static_cast<int>(array.bit_offset % 8));
+        const __m128i sign_bits = _mm_cvtsi32_si128(
+            array.is_signed ? static_cast<int>(32 - array.bit_size) : 0);
+        const __m256i mask = _mm256_set1_epi32(static_cast<int>(bit_mask(array.bit_size)));
+        for (std::size_t i = 0; i < vector_count; i += LANES)
+        {
+            // the gather and the store have no alignment requirement
+            const auto* base = static_cast<const int*>(
+                static_cast<const void*>(data + first_byte + (i * byte_stride)));
+            __m256i raw = _mm256_i32gather_epi32(base, lane_offsets, 1);
+            raw = _mm256_and_si256(_mm256_srl_epi32(raw, shift), mask);
+            raw = _mm256_sra_epi32(_mm256_sll_epi32(raw, sign_bits), sign_bits);
+            _mm256_storeu_si256(static_cast<__m256i*>(static_cast<void*>(values + i)), raw);
+        }
+        return vector_count;
+    }
+#endif
+
+    static constexpr std::uint64_t load(const std::uint8_t* bytes)
+    {
+        std::uint64_t raw = 0;
+        for (std::size_t i = 0; i < BYTE_COUNT; ++i)
+        {
+            raw |= static_cast<std::uint64_t>(bytes[i]) << (i * 8);
+        }
+        return raw;
+    }
+    static constexpr void store(std::uint8_t* bytes, std::uint32_t value)
+    {
+        for (std::size_t i = 0; i < BYTE_COUNT; ++i)
+        {
+            bytes[i] = static_cast<std::uint8_t>(value >> (i * 8));
+        }
+    }
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+};
+
+/// @brief  Reads the elements of a bit field array, using the kernel that matches its shape.
+/// @param  data: the buffer, it must contain all bytes spanned by the array
+/// @param  array: the location and format of the elements
+/// @param  values: the output buffer, with at least array.count elements
+constexpr void extract(std::span<const std::uint8_t> data, const bit_field_array& array,
+                       std::span<std::int32_t> values)
+{
+    HID_RP_ASSERT((array.bit_end() <= (data.size() * 8)) and (values.size() >= array.count),
+                  ex_report_invalid_size);
+    switch (array.shape())
+    {
+    case bit_field_shape::BIT:
+        return bit_field_kernel<bit_field_shape::BIT>::extract(data.data(), array, values.data());
+    case bit_field_shape::BYTE:
+        return bit_field_kernel<bit_field_shape::BYTE>::extract(data.data(), array, values.data());
+    case bit_field_shape::WORD:
+        return bit_field_kernel<bit_field_shape::WORD>::extract(data.data(), array, values.data());
+    case bit_field_shape::DWORD:
+        return bit_field_kernel<bit_field_shape::DWORD>::extract(data.data(), array,
+                                                                 values.data());
+    case bit_field_shape::SHIFTED:
+        switch (array.element_byte_count())
+        {
+        case 1:
+            return bit_field_kernel<bit_field_shape::SHIFTED, 1>::extract(data.data(), array,
+                                                                          values.data());
+        case 2:
+            return bit_field_kernel<bit_field_shape::SHIFTED, 2>::extract(data.data(), array,
+                                                                          values.data());
+        case 3:
+            return bit_field_kernel<bit_field_shape::SHIFTED, 3>::extract(data.data(), array,
+                                                                          values.data());
+        case 4:
+            return bit_field_kernel<bit_field_shape::SHIFTED, 4>::extract(data.data(), array,
+                                                                          values.data());
+        default:
+            return bit_field_kernel<bit_field_shape::SHIFTED, 5>::extract(data.data(), array,
+                                                                          values.data());
+        }
+    default:
+        return bit_field_kernel<bit_field_shape::UNALIGNED>::extract(data.data(), array,
+                                                                     values.data());
+    }
+}
+
+/// @brief  Writes the elements of a bit field array, using the kernel that matches its shape.
+///         The bits outside of the elements remain unchanged.
+/// @param  data: the buffer, it must contain all bytes spanned by the array
+/// @param  array: the location and format of the elements
+/// @param  values: the input values, with at least array.count elements
+constexpr void insert(std::span<std::uint8_t> data, const bit_field_array& array,
+                      std::span<const std::int32_t> values)
+{
+    HID_RP_ASSERT((array.bit_end() <= (data.size() * 8)) and (values.size() >= array.count),
+                  ex_report_invalid_size);
+    switch (array.shape())
+    {
+    case bit_field_shape::BYTE:
+        return bit_field_kernel<bit_field_shape::BYTE>::insert(data.data(), array, values.data());
+    case bit_field_shape::WORD:
+        return bit_field_kernel<bit_field_shape::WORD>::insert(data.data(), array, values.data());
+    case bit_field_shape::DWORD:
+        return bit_field_kernel<bit_field_shape::DWORD>::insert(data.data(), array, values.data());
+    default:
+        return bit_field_kernel<bit_field_shape::UNALIGNED>::insert(data.data(), array,
+                                                                    values.data());
+    }
+}
+
+/// @brief  Calls a function with the index of each set bit in a bitset
+///         (such as a @ref hid::report_bitset of buttons), skipping the cleared bytes.
+/// @param  data: the buffer, it must contain all bytes spanned by the bitset
+/// @param  bit_offset: the bit offset of the bitset's first bit
+/// @param  count: the number of bits in the bitset
+/// @param  func: the function to call with each set bit's index
+template <typename TFunc>
+constexpr void for_each_set_bit(std::span<const std::uint8_t> data, std::size_t bit_offset,
+                                std::size_t count, TFunc&& func)
+{
+    HID_RP_ASSERT((bit_offset + count) <= (data.size() * 8), ex_report_invalid_size);
+    for (std::size_t index = 0; index < count;)
+    {
+        // the remaining bits of the current byte
+        const auto pos = bit_offset + index;
+        const auto bits_in_byte = std::min<std::size_t>(8 - (pos % 8), count - index);
+        auto bits =
+            (static_cast<std::uint32_t>(data[pos / 8]) >> (pos % 8)) & bit_mask(bits_in_byte);
+        while (bits != 0)
+        {
+            func(index + static_cast<std::size_t>(std::countr_zero(bits)));
+            bits &= bits - 1;
+        }
+        index += bits_in_byte;
+    }
+}
+
+} // namespace hid
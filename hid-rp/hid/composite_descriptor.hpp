@@ -0,0 +1,198 @@
+// SPDX-License-Identifier: MPL-2.0
+#pragma once
+
+#include <array>
+#include <span>
+#include "hid/rdf/global_items.hpp"
+#include "hid/report_protocol.hpp"
+
+namespace hid
+{
+/// @brief This class describes the report ID that a top-level collection's report ID
+///        was replaced with in a composite descriptor.
+struct report_id_mapping
+{
+    std::uint8_t tlc_index{};
+    report::id::type source_id{}; ///< the report ID in the top-level collection's descriptor
+    report::id::type id{};        ///< the report ID in the composite descriptor
+
+    constexpr bool operator==(const report_id_mapping& other) const = default;
+    constexpr bool operator!=(const report_id_mapping& other) const = default;
+};
+
+/// @brief This class merges top-level collection descriptors into a single descriptor,
+///        replacing their report IDs with densely assigned ones (starting from 1),
+///        in the order of their appearance. Top-level collections without report IDs
+///        receive a report ID item right after their application collection begins.
+class tlc_composer
+{
+  public:
+    /// @brief Creates a composer that writes to the provided storage.
+    /// @param assign_ids: whether to assign report IDs, or to copy the descriptors unchanged
+    /// @param buffer: the output storage of the composite descriptor, pass an empty span to only
+    ///        calculate the required size with @ref size
+    /// @param mapping: the output storage of the report ID mappings, pass an empty span to only
+    ///        calculate the required size with @ref mapping_count
+    constexpr tlc_composer(bool assign_ids, std::span<rdf::byte_type> buffer,
+                           std::span<report_id_mapping> mapping)
+        : buffer_(buffer), mapping_(mapping), assign_ids_(assign_ids)
+    {}
+
+    /// @brief Appends a top-level collection's descriptor to the composite descriptor.
+    /// @param tlc: the top-level collection's descriptor view
+    template <typename TIterator>
+    constexpr void add(const rdf::descriptor_view_base<TIterator>& tlc)
+    {
+        using namespace hid::rdf;
+
+        bool id_present = !assign_ids_;
+        for (const auto& item : tlc)
+        {
+            id_present = id_present or item.has_tag(global::tag::REPORT_ID);
+        }
+        source_ids_.fill(0);
+
+        std::size_t offset = 0;
+        for (auto item_iter = tlc.begin(); item_iter != tlc.end(); ++item_iter)
+        {
+            HID_RP_ASSERT(tlc.is_item_complete(item_iter), ex_invalid_bounds);
+            const auto& this_item = *item_iter;
+            const std::size_t item_size = this_item.size();
+
+            if (assign_ids_ and this_item.has_tag(global::tag::REPORT_ID))
+            {
+                // the item keeps its data size, the new ID fits in any
+                const auto id = map_id(static_cast<report::id::type>(this_item.value_unsigned()));
+                write(tlc.data()[offset]);
+                for (std::size_t i = 1; i < item_size; ++i)
+                {
+                    write((i == 1) ? id : 0);
+                }
+            }
+            else
+            {
+                for (std::size_t i = 0; i < item_size; ++i)
+                {
+                    write(tlc.data()[offset + i]);
+                }
+            }
+            offset += item_size;
+
+            if (!id_present and this_item.has_tag(main::tag::COLLECTION))
+            {
+                for (auto byte : report_id(map_id(0)))
+                {
+                    write(byte);
+                }
+                id_present = true;
+            }
+        }
+        tlc_count_++;
+    }
+
+    /// @brief The size of the composite descriptor.
+    [[nodiscard]] constexpr std::size_t size() const { return size_; }
+
+    /// @brief The number of report IDs that were assigned.
+    [[nodiscard]] constexpr std::size_t mapping_count() const { return mapping_count_; }
+
+  private:
+    constexpr void write(rdf::byte_type byte)
+    {
+        if (!buffer_.empty())
+        {
+            HID_RP_ASSERT(size_ < buffer_.size(), ex_descriptor_buffer_overflow);
+            buffer_[size_] = byte;
+        }
+        size_++;
+    }
+
+    constexpr report::id::type map_id(report::id::type source_id)
+    {
+        auto& id = source_ids_[source_id];
+        if (id == 0)
+        {
+            HID_RP_ASSERT(mapping_count_ < report::id::max(), ex_report_id_excess);
+            id = static_cast<report::id::type>(mapping_count_ + 1);
+            if (mapping_count_ < mapping_.size())
+            {
+                mapping_[mapping_count_] = {static_cast<std::uint8_t>(tlc_count_), source_id, id};
+            }
+            mapping_count_++;
+        }
+        return id;
+    }
+
+    std::span<rdf::byte_type> buffer_;
+    std::span<report_id_mapping> mapping_;
+    std::array<report::id::type, 256> source_ids_{};
+    std::size_t size_{};
+    std::size_t mapping_count_{};
+    std::size_t tlc_count_{};
+    bool assign_ids_;
+};
+
+/// @brief This class holds a composite descriptor, and the mapping of its report IDs.
+template <std::size_t SIZE, std::size_t MAPPING_COUNT>
+struct composite_descriptor
+{
+    rdf::array<SIZE> descriptor{};
+    std::array<report_id_mapping, MAPPING_COUNT> report_ids{};
+
+    /// @brief  Translates a report selector of a top-level collection's descriptor
+    ///         to the composite descriptor.
+    /// @param  tlc_index: the top-level collection's index in the composition
+    /// @param  select: the report selector in the top-level collection's descriptor
+    /// @return The report selector in the composite descriptor, or the input selector if
+    ///         the report IDs weren't reassigned
+    [[nodiscard]] constexpr report::selector remap(std::size_t tlc_index,
+                                                   report::selector select) const
+    {
+        for (const auto& mapping : report_ids)
+        {
+            if ((mapping.tlc_index == tlc_index) and (mapping.source_id == select.id()))
+            {
+                return {select.type(), mapping.id};
+            }
+        }
+        return select;
+    }
+};
+
+/// @brief  Composes top-level collection descriptors into a single descriptor at compile-time,
+///         assigning dense report IDs to them. Report ID 0 is only kept when a single top-level
+///         collection without report IDs is composed. The result is validated
+///         by @ref report_protocol, so an invalid composition fails the compilation.
+/// @tparam Tlcs: the top-level collection descriptor arrays, e.g. from
+///         @ref hid::app::keyboard::app_report_descriptor
+/// @return The @ref composite_descriptor, with the report ID mapping of each top-level collection
+template <auto... Tlcs>
+consteval auto make_composite_descriptor()
+{
+    static_assert(sizeof...(Tlcs) > 0);
+    constexpr bool ASSIGN_IDS = []
+    {
+        if constexpr (sizeof...(Tlcs) == 1)
+        {
+            return report_protocol::from_descriptor<Tlcs...>().uses_report_ids();
+        }
+        return true;
+    }();
+    constexpr auto COMPOSER = []
+    {
+        tlc_composer composer(ASSIGN_IDS, {}, {});
+        (composer.add(rdf::ce_descriptor_view::from_descriptor<Tlcs>()), ...);
+        return std::array<std::size_t, 2>{composer.size(), composer.mapping_count()};
+    }();
+
+    composite_descriptor<COMPOSER[0], COMPOSER[1]> result{};
+    tlc_composer composer(ASSIGN_IDS, result.descriptor, result.report_ids);
+    (composer.add(rdf::ce_descriptor_view::from_descriptor<Tlcs>()), ...);
+
+    // the parsing fails the compilation if the result isn't valid
+    [[maybe_unused]] const report_protocol_properties properties{
+        rdf::ce_descriptor_view(result.descriptor)};
+    return result;
+}
+
+} // namespace hid
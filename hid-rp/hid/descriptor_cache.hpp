@@ -0,0 +1,145 @@
+// SPDX-License-Identifier: MPL-2.0
+#pragma once
+
+#include <list>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+#include "hid/report_dispatch_table.hpp"
+
+namespace hid
+{
+/// @brief  Calculates the 64-bit FNV-1a hash of a report descriptor,
+///         which identifies identical descriptors (non-cryptographically).
+/// @param  data: the raw descriptor
+/// @return The descriptor's fingerprint
+[[nodiscard]] constexpr std::uint64_t descriptor_fingerprint(std::span<const std::uint8_t> data)
+{
+    constexpr std::uint64_t offset_basis = 0xcbf29ce484222325;
+    constexpr std::uint64_t prime = 0x100000001b3;
+    std::uint64_t hash = offset_basis;
+    for (auto byte : data)
+    {
+        hash = (hash ^ byte) * prime;
+    }
+    return hash;
+}
+
+/// @brief This class holds the immutable results of parsing a report descriptor at runtime:
+///        a copy of the descriptor, its report layout and its report dispatch table.
+class parsed_descriptor
+{
+  public:
+    /// @brief Parses and validates a descriptor, throws if it is invalid.
+    /// @param data: the raw descriptor
+    explicit parsed_descriptor(std::span<const std::uint8_t> data)
+        : descriptor_(data.begin(), data.end())
+    {
+        using parser = report_layout::parser<rdf::reinterpret_iterator>;
+
+        auto view = rdf::descriptor_view(descriptor_.data(), descriptor_.size());
+        fields_.resize(parser(view, {}).field_count());
+        dispatch_table_ = report_dispatch_table(parser(view, fields_).layout());
+    }
+
+    // the dispatch table refers to the owned fields
+    parsed_descriptor(const parsed_descriptor&) = delete;
+    parsed_descriptor& operator=(const parsed_descriptor&) = delete;
+    parsed_descriptor(parsed_descriptor&&) = delete;
+    parsed_descriptor& operator=(parsed_descriptor&&) = delete;
+    ~parsed_descriptor() = default;
+
+    [[nodiscard]] std::span<const std::uint8_t> descriptor() const { return descriptor_; }
+    [[nodiscard]] report_layout layout() const { return report_layout(fields_); }
+    [[nodiscard]] const report_dispatch_table& dispatch_table() const { return dispatch_table_; }
+
+  private:
+    std::vector<std::uint8_t> descriptor_;
+    std::vector<report_field> fields_{};
+    report_dispatch_table dispatch_table_{};
+};
+
+/// @brief This class caches parsed descriptors by their content, so that all devices
+///        with identical report descriptors share a single parsed instance.
+///        When the capacity is reached, the least recently used entry is evicted.
+///        The class isn't thread-safe, the caller must serialize concurrent access.
+class descriptor_cache
+{
+  public:
+    using value_type = std::shared_ptr<const parsed_descriptor>;
+
+    struct statistics
+    {
+        std::size_t hits{};
+        std::size_t misses{};
+        std::size_t evictions{};
+    };
+
+    /// @brief Creates an empty cache.
+    /// @param capacity: the maximum number of cached descriptors, at least 1
+    explicit descriptor_cache(std::size_t capacity)
+        : capacity_(capacity)
+    {
+        HID_RP_ASSERT(capacity > 0, ex_cache_capacity_zero);
+    }
+
+    /// @brief  Looks up a descriptor in the cache, and parses it when it isn't present.
+    ///         Invalid descriptors throw the parser's exception, and leave the cache unchanged.
+    /// @param  data: the raw descriptor
+    /// @return Shared reference to the parsed descriptor, which stays valid after eviction
+    value_type get(std::span<const std::uint8_t> data)
+    {
+        auto fingerprint = descriptor_fingerprint(data);
+        auto it = index_.find(fingerprint);
+        if ((it != index_.end()) and std::ranges::equal(it->second->value->descriptor(), data))
+        {
+            ++stats_.hits;
+            lru_.splice(lru_.begin(), lru_, it->second);
+            return it->second->value;
+        }
+
+        // parse first, so an invalid descriptor doesn't displace a cached one
+        ++stats_.misses;
+        auto value = std::make_shared<const parsed_descriptor>(data);
+        if (it != index_.end())
+        {
+            // fingerprint collision, the new descriptor replaces the cached one
+            lru_.erase(it->second);
+            index_.erase(it);
+        }
+        else if (lru_.size() >= capacity_)
+        {
+            ++stats_.evictions;
+            index_.erase(lru_.back().fingerprint);
+            lru_.pop_back();
+        }
+        lru_.push_front({fingerprint, value});
+        index_.emplace(fingerprint, lru_.begin());
+        return value;
+    }
+
+    [[nodiscard]] std::size_t size() const { return lru_.size(); }
+    [[nodiscard]] std::size_t capacity() const { return capacity_; }
+    [[nodiscard]] const statistics& stats() const { return stats_; }
+
+    /// @brief Removes all entries, the statistics are kept.
+    void clear()
+    {
+        index_.clear();
+        lru_.clear();
+    }
+
+  private:
+    struct entry
+    {
+        std::uint64_t fingerprint;
+        value_type value;
+    };
+
+    std::size_t capacity_;
+    std::list<entry> lru_{}; // most recently used first
+    std::unordered_map<std::uint64_t, std::list<entry>::iterator> index_{};
+    statistics stats_{};
+};
+
+} // namespace hid
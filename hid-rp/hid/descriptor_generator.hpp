@@ -0,0 +1,458 @@
+// SPDX-License-Identifier: MPL-2.0
+#pragma once
+
+#include <optional>
+#include <utility>
+#include <vector>
+#include "hid/report_layout.hpp"
+
+namespace hid
+{
+/// @brief Small, fast and reproducible pseudo-random number generator (SplitMix64),
+///        the generated sequence only depends on the seed, on all platforms.
+class pseudo_random
+{
+  public:
+    constexpr explicit pseudo_random(std::uint64_t seed)
+        : state_(seed)
+    {}
+
+    constexpr std::uint64_t operator()()
+    {
+        std::uint64_t z = (state_ += 0x9e3779b97f4a7c15);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+        return z ^ (z >> 31);
+    }
+
+    /// @brief  Generates a number in the closed range.
+    template <std::integral T>
+    constexpr T uniform(T min, T max)
+    {
+        auto span = static_cast<std::uint64_t>(static_cast<std::int64_t>(max) -
+                                               static_cast<std::int64_t>(min)) +
+                    1;
+        return static_cast<T>(static_cast<std::int64_t>(min) +
+                              static_cast<std::int64_t>((*this)() % span));
+    }
+
+    /// @brief  Returns true with the given chance.
+    constexpr bool chance(unsigned percent) { return uniform(1U, 100U) <= percent; }
+
+  private:
+    std::uint64_t state_;
+};
+
+/// @brief This class generates random, but valid HID report descriptors of controllable structure
+///        and size, for scaling and stress tests of the descriptor processing.
+///        The generated descriptors pass the @ref report_protocol validation.
+class descriptor_generator
+{
+  public:
+    /// @brief Controls the encoded data size of the items' values.
+    enum class data_size_policy : std::uint8_t
+    {
+        MINIMAL, ///< the shortest encoding of each value
+        RANDOM,  ///< random data size that fits the value
+        MAXIMAL, ///< 4 bytes for each value
+    };
+
+    /// @brief The largest supported report byte size,
+    ///        the reports' bit sizes are tracked in 16 bits during validation.
+    static constexpr std::uint16_t max_report_size_limit = 0x1fff;
+
+    struct config
+    {
+        std::uint64_t seed{1};
+        unsigned tlc_count{1};             ///< number of top-level (application) collections
+        unsigned nesting_depth{2};         ///< max depth of collections, including the TLC
+        unsigned report_id_count{};        ///< 0 to not use report IDs (only with a single TLC)
+        unsigned fields_per_tlc{8};        ///< number of report data fields in each TLC
+        std::size_t target_size{};         ///< when set, fields are added until reaching this size
+                                           ///< (or until all reports are full)
+        std::uint16_t max_report_size{64}; ///< max byte size of each report (without report ID)
+        bool push_pop{};                   ///< wrap some fields in PUSH / POP items
+        data_size_policy data_sizes{data_size_policy::MINIMAL};
+    };
+
+    constexpr explicit descriptor_generator(const config& cfg)
+        : config_(cfg), random_(cfg.seed)
+    {
+        config_.tlc_count = std::clamp(config_.tlc_count, 1U, unsigned{report::id::max()});
+        config_.nesting_depth = std::max(config_.nesting_depth, 1U);
+        // multiple TLCs can't share the same report
+        if ((config_.report_id_count > 0) or (config_.tlc_count > 1))
+        {
+            config_.report_id_count = std::clamp(config_.report_id_count, config_.tlc_count,
+                                                 unsigned{report::id::max()});
+        }
+        config_.max_report_size =
+            std::clamp<std::uint16_t>(config_.max_report_size, 1, max_report_size_limit);
+    }
+
+    /// @brief  Generates the descriptor.
+    /// @return The raw descriptor
+    std::vector<rdf::byte_type> generate()
+    {
+        out_.clear();
+        for (unsigned tlc = 0; tlc < config_.tlc_count; ++tlc)
+        {
+            std::size_t size_goal = (config_.target_size * (tlc + 1)) / config_.tlc_count;
+            generate_tlc(tlc, size_goal);
+        }
+        return std::move(out_);
+    }
+
+  private:
+    static constexpr std::size_t global_tag_count = 10;
+
+    using global_values = std::array<std::optional<std::uint32_t>, global_tag_count>;
+
+    [[nodiscard]] constexpr report::id::type first_report_id(unsigned tlc) const
+    {
+        return static_cast<report::id::type>(1 + (tlc * config_.report_id_count) /
+                                                     config_.tlc_count);
+    }
+
+    void generate_tlc(unsigned tlc, std::size_t size_goal)
+    {
+        using namespace rdf;
+        constexpr std::array<std::uint16_t, 3> tlc_pages{0x01, 0x0c, 0xff00};
+
+        globals_ = {};
+        report_bit_sizes_ = {};
+        id_min_ = id_max_ = 0;
+        if (config_.report_id_count > 0)
+        {
+            id_min_ = first_report_id(tlc);
+            id_max_ = static_cast<report::id::type>(first_report_id(tlc + 1) - 1);
+        }
+
+        auto page = tlc_pages[random_.uniform<std::size_t>(0, tlc_pages.size() - 1)];
+        add_global(global::tag::USAGE_PAGE, page);
+        add_usage(page, random_.uniform<std::uint16_t>(1, 0xff));
+        add_item(main::tag::COLLECTION,
+                 static_cast<std::uint32_t>(main::collection_type::APPLICATION));
+
+        unsigned depth = 1;
+        for (unsigned field = 0;; ++field)
+        {
+            if ((config_.target_size > 0) ? (out_.size() >= size_goal)
+                                          : (field >= config_.fields_per_tlc))
+            {
+                break;
+            }
+            if ((depth < config_.nesting_depth) and random_.chance(20))
+            {
+                constexpr std::array<main::collection_type, 3> types{
+                    main::collection_type::PHYSICAL, main::collection_type::LOGICAL,
+                    main::collection_type::REPORT};
+                add_item(main::tag::COLLECTION,
+                         static_cast<std::uint32_t>(
+                             types[random_.uniform<std::size_t>(0, types.size() - 1)]));
+                depth++;
+            }
+            else if ((depth > 1) and random_.chance(15))
+            {
+                add_item(main::tag::END_COLLECTION);
+                depth--;
+            }
+            if (!generate_field())
+            {
+                // all reports of the TLC are full
+                break;
+            }
+        }
+        for (; depth > 1; --depth)
+        {
+            add_item(main::tag::END_COLLECTION);
+        }
+        add_padding();
+        add_item(main::tag::END_COLLECTION);
+    }
+
+    bool generate_field()
+    {
+        using namespace rdf;
+        constexpr std::array<std::uint16_t, 5> pages{0x01, 0x09, 0x0c, 0x0d, 0xff00};
+        constexpr std::array<std::uint16_t, 6> variable_sizes{1, 2, 4, 8, 12, 16};
+
+        auto rtype = report::type::INPUT;
+        if (random_.chance(40))
+        {
+            rtype = random_.chance(50) ? report::type::OUTPUT : report::type::FEATURE;
+        }
+        bool variable = random_.chance(75);
+        std::uint16_t size = variable ? variable_sizes[random_.uniform<std::size_t>(
+                                            0, variable_sizes.size() - 1)]
+                                      : 8;
+        std::uint16_t count = random_.uniform<std::uint16_t>(1, variable ? 8 : 6);
+
+        // pick a report ID with enough space left, starting from a random one
+        auto id = random_.uniform(id_min_, id_max_);
+        std::size_t max_bits = static_cast<std::size_t>(config_.max_report_size) * 8;
+        for (auto i = id_min_;; ++i)
+        {
+            if ((bit_size(rtype, id) + (size * count)) <= max_bits)
+            {
+                break;
+            }
+            if (i == id_max_)
+            {
+                return false;
+            }
+            id = (id == id_max_) ? id_min_ : static_cast<report::id::type>(id + 1);
+        }
+        bit_size(rtype, id) += size * count;
+
+        bool pushed = config_.push_pop and random_.chance(25);
+        if (pushed)
+        {
+            add_item(global::tag::PUSH);
+            global_stack_ = globals_;
+        }
+
+        auto page = pages[random_.uniform<std::size_t>(0, pages.size() - 1)];
+        std::int32_t logical_min{};
+        std::int32_t logical_max{};
+        auto usage_min = random_.uniform<std::uint16_t>(1, 0x200);
+        std::uint16_t usage_count = count;
+        std::uint16_t flags = main::data_field_flag::DATA;
+        if (variable)
+        {
+            flags |= main::data_field_flag::VARIABLE;
+            if (size == 1)
+            {
+                logical_max = 1;
+            }
+            else if (random_.chance(50))
+            {
+                logical_min = -(1 << (size - 1));
+                logical_max = (1 << (size - 1)) - 1;
+                flags |= random_.chance(50) ? main::data_field_flag::RELATIVE : 0;
+            }
+            else
+            {
+                logical_max = (1 << size) - 1;
+            }
+        }
+        else
+        {
+            // array values select from a range of usages, 0 means no selection
+            usage_count = random_.uniform<std::uint16_t>(1, 0xff);
+            logical_min = 1;
+            logical_max = usage_count;
+        }
+
+        add_global(global::tag::USAGE_PAGE, page);
+        add_global(global::tag::LOGICAL_MINIMUM, static_cast<std::uint32_t>(logical_min), true);
+        add_global(global::tag::LOGICAL_MAXIMUM, static_cast<std::uint32_t>(logical_max), true);
+        add_global(global::tag::REPORT_SIZE, size);
+        if (id > 0)
+        {
+            add_global(global::tag::REPORT_ID, id);
+        }
+        add_global(global::tag::REPORT_COUNT, count);
+
+        if (variable and (count <= 4) and random_.chance(50))
+        {
+            for (std::uint16_t i = 0; i < count; ++i)
+            {
+                add_usage(page, static_cast<std::uint16_t>(usage_min + i));
+            }
+        }
+        else
+        {
+            add_usage_limits(page, usage_min,
+                             static_cast<std::uint16_t>(usage_min + usage_count - 1));
+        }
+        add_item(data_field_tag(rtype), flags);
+
+        if (pushed)
+        {
+            add_item(global::tag::POP);
+            globals_ = global_stack_;
+        }
+        return true;
+    }
+
+    /// @brief Completes each report of the TLC to byte size with padding bits.
+    void add_padding()
+    {
+        using namespace rdf;
+        for (auto rtype : {report::type::INPUT, report::type::OUTPUT, report::type::FEATURE})
+        {
+            for (auto id = id_min_;; ++id)
+            {
+                if (auto bits = bit_size(rtype, id) % 8; bits > 0)
+                {
+                    add_global(global::tag::REPORT_SIZE, 8 - bits);
+                    if (id > 0)
+                    {
+                        add_global(global::tag::REPORT_ID, id);
+                    }
+                    add_global(global::tag::REPORT_COUNT, 1);
+                    add_item(data_field_tag(rtype), main::data_field_flag::CONSTANT);
+                }
+                if (id == id_max_)
+                {
+                    break;
+                }
+            }
+        }
+    }
+
+    static constexpr rdf::main::tag data_field_tag(report::type rtype)
+    {
+        switch (rtype)
+        {
+        case report::type::INPUT:
+            return rdf::main::tag::INPUT;
+        case report::type::OUTPUT:
+            return rdf::main::tag::OUTPUT;
+        default:
+            return rdf::main::tag::FEATURE;
+        }
+    }
+
+    [[nodiscard]] constexpr std::size_t& bit_size(report::type rtype, report::id::type id)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+        return report_bit_sizes_[static_cast<std::size_t>(rtype) - 1][id];
+    }
+
+    /// @brief Picks the encoded data size of a value, according to the policy.
+    std::uint8_t data_size(std::uint32_t value, bool is_signed)
+    {
+        std::uint8_t min_size = 4;
+        if (value == 0)
+        {
+            min_size = 0;
+        }
+        else if (is_signed ? (static_cast<std::int8_t>(value) == static_cast<std::int32_t>(value))
+                           : (value <= 0xff))
+        {
+            min_size = 1;
+        }
+        else if (is_signed ? (static_cast<std::int16_t>(value) == static_cast<std::int32_t>(value))
+                           : (value <= 0xffff))
+        {
+            min_size = 2;
+        }
+        switch (config_.data_sizes)
+        {
+        case data_size_policy::MAXIMAL:
+            return 4;
+        case data_size_policy::RANDOM:
+        {
+            constexpr std::array<std::uint8_t, 4> sizes{0, 1, 2, 4};
+            auto first = static_cast<std::size_t>(
+                std::ranges::find(sizes, min_size) - sizes.begin());
+            return sizes[random_.uniform<std::size_t>(first, sizes.size() - 1)];
+        }
+        default:
+            return min_size;
+        }
+    }
+
+    void add_raw_item(rdf::tag unified_tag, std::uint32_t value, std::uint8_t size)
+    {
+        out_.push_back(static_cast<rdf::byte_type>(
+            (static_cast<rdf::byte_type>(unified_tag) << 2) | ((size == 4) ? 3 : size)));
+        for (std::uint8_t i = 0; i < size; ++i)
+        {
+            out_.push_back(static_cast<rdf::byte_type>(value >> (8 * i)));
+        }
+    }
+
+    template <typename TTag>
+    static constexpr rdf::tag unified(TTag tag)
+    {
+        return static_cast<rdf::tag>((static_cast<rdf::byte_type>(tag) << 2) |
+                                     static_cast<rdf::byte_type>(rdf::match_type<TTag>()));
+    }
+
+    /// @brief Adds a main item, its data is always minimal sized.
+    void add_item(rdf::main::tag tag, std::uint32_t value = 0)
+    {
+        auto policy = std::exchange(config_.data_sizes, data_size_policy::MINIMAL);
+        add_raw_item(unified(tag), value, data_size(value, false));
+        config_.data_sizes = policy;
+    }
+
+    void add_item(rdf::global::tag tag) { add_raw_item(unified(tag), 0, 0); }
+
+    /// @brief Adds a global item, unless the current global state already holds the value.
+    void add_global(rdf::global::tag tag, std::uint32_t value, bool is_signed = false)
+    {
+        auto& current = globals_[static_cast<std::size_t>(tag)];
+        if (current != value)
+        {
+            add_raw_item(unified(tag), value, data_size(value, is_signed));
+            current = value;
+        }
+    }
+
+    void add_usage(std::uint16_t page, std::uint16_t id)
+    {
+        auto size = data_size(id, false);
+        // 4 byte usages are extended, carrying the usage page as well
+        add_raw_item(unified(rdf::local::tag::USAGE),
+                     (size == 4) ? ((std::uint32_t{page} << 16) | id) : id, size);
+    }
+
+    void add_usage_limits(std::uint16_t page, std::uint16_t min, std::uint16_t max)
+    {
+        // the limits must have the same size when extended
+        auto size = std::max(data_size(min, false), data_size(max, false));
+        std::uint32_t extension = (size == 4) ? (std::uint32_t{page} << 16) : 0;
+        add_raw_item(unified(rdf::local::tag::USAGE_MINIMUM), extension | min, size);
+        add_raw_item(unified(rdf::local::tag::USAGE_MAXIMUM), extension | max, size);
+    }
+
+    config config_;
+    pseudo_random random_;
+    std::vector<rdf::byte_type> out_{};
+    global_values globals_{};
+    global_values global_stack_{};
+    std::array<std::array<std::size_t, report::id::max() + 1>, 3> report_bit_sizes_{};
+    report::id::type id_min_{};
+    report::id::type id_max_{};
+};
+
+/// @brief Fills a report buffer with random, but valid values for each report field:
+///        values within the logical limits, and zeroed padding bits.
+/// @param fields: the report's fields, acquired from @ref report_layout::fields(selector)
+/// @param random: the random number generator
+/// @param report: the report buffer, it must contain all bytes spanned by the fields
+inline void generate_report(report_layout::fields_view fields, pseudo_random& random,
+                            std::span<std::uint8_t> report)
+{
+    std::ranges::fill(report, 0);
+    if (fields.empty())
+    {
+        return;
+    }
+    HID_RP_ASSERT(fields.back().bit_end() <= (report.size() * 8), ex_report_invalid_size);
+    if (auto id = fields.front().selector.id(); id > 0)
+    {
+        report.front() = id;
+    }
+    for (const auto& field : fields)
+    {
+        if (field.is_padding() or field.is_constant())
+        {
+            continue;
+        }
+        for (std::size_t i = 0; i < field.count; ++i)
+        {
+            // array elements may also be empty (out of range)
+            auto min = field.is_array() ? (field.logical_min - 1) : field.logical_min;
+            auto value = random.uniform(min, field.logical_max);
+            insert_bits(report, field.element_bit_offset(i), field.bit_size,
+                        static_cast<std::uint32_t>(value));
+        }
+    }
+}
+
+} // namespace hid
@@ -0,0 +1,86 @@
+// SPDX-License-Identifier: MPL-2.0
+#pragma once
+
+#include <array>
+#include "hid/report.hpp"
+#include "hid/report_layout.hpp"
+
+namespace hid
+{
+/// @brief This class template is a report storage structure that is synthesized from
+///        the HID report descriptor, instead of being written by hand to match it.
+///        Its size is exactly the report's size, and its values are accessed by their usages,
+///        at bit offsets that are resolved at compile-time.
+/// @tparam Data: the descriptor array, acquired e.g. from a @ref hid::rdf::descriptor call
+/// @tparam TYPE: the report type
+/// @tparam REPORT_ID: the report ID, 0 if the descriptor doesn't use report IDs
+template <auto Data, report::type TYPE, report::id::type REPORT_ID = 0>
+class packed_report : public report::base<TYPE, REPORT_ID>
+{
+    using base_t = report::base<TYPE, REPORT_ID>;
+    static constexpr report_layout LAYOUT{report_layout_table<Data>};
+    static constexpr std::size_t SIZE = LAYOUT.report_size(base_t::selector());
+    static constexpr std::size_t ID_SIZE = base_t::has_id() ? sizeof(report::id) : 0;
+    static_assert(SIZE > ID_SIZE, "the descriptor doesn't define this report");
+
+  public:
+    using base_t::has_id;
+    using base_t::selector;
+
+    /// @brief The report's fields, ordered by bit offset.
+    [[nodiscard]] static constexpr report_layout::fields_view fields()
+    {
+        return LAYOUT.fields(selector());
+    }
+
+    /// @brief The size of the report in bytes, including the report ID.
+    [[nodiscard]] static constexpr std::size_t size() { return SIZE; }
+
+    /// @brief  Locates the single variable element that a usage is assigned to.
+    /// @tparam USAGE: the usage of the element
+    /// @return The element as a field with a single usage and count,
+    ///         its bit offset is relative to the start of the report, including the report ID
+    template <auto USAGE>
+    [[nodiscard]] static consteval report_field element()
+    {
+        constexpr auto elem = field_of<Data, TYPE, REPORT_ID, USAGE>();
+        static_assert(elem.is_variable(), "the usage is assigned to an array field");
+        return elem;
+    }
+
+    /// @brief  Reads the value of a usage's element.
+    /// @tparam USAGE: the usage of the element
+    /// @return The element's value, sign extended if the logical minimum is negative
+    template <auto USAGE>
+    [[nodiscard]] constexpr std::int32_t get() const
+    {
+        constexpr auto elem = element<USAGE>();
+        const auto value = extract_bits(payload_, payload_bit_offset(elem), elem.bit_size);
+        return elem.is_signed() ? sign_extend(value, elem.bit_size)
+                                : static_cast<std::int32_t>(value);
+    }
+
+    /// @brief  Writes the value of a usage's element, leaving the other elements unchanged.
+    /// @tparam USAGE: the usage of the element
+    /// @param  value: the new value, truncated to the element's size
+    template <auto USAGE>
+    constexpr void set(std::int32_t value)
+    {
+        constexpr auto elem = element<USAGE>();
+        insert_bits(payload_, payload_bit_offset(elem), elem.bit_size,
+                    static_cast<std::uint32_t>(value));
+    }
+
+    constexpr packed_report() = default;
+    bool operator==(const packed_report& other) const = default;
+
+  private:
+    static constexpr std::size_t payload_bit_offset(const report_field& elem)
+    {
+        return elem.bit_offset - (8 * ID_SIZE);
+    }
+
+    std::array<std::uint8_t, SIZE - ID_SIZE> payload_{};
+};
+
+} // namespace hid
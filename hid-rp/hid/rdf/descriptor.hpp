@@ -8,6 +8,7 @@
 namespace hid::rdf
 {
 /// @brief  This function puts the input HID report descriptor elements into a single descriptor.
+///         Each element is copied once into the result, see @ref concat.
 /// @tparam sz: deduced template parameter
 /// @param  items: either individual items, or item collections
 /// @return The HID report descriptor as an std::array
@@ -15,7 +16,7 @@ template <std::size_t... sz>
 constexpr auto descriptor(array<sz>... items)
     requires(sizeof...(items) > 0)
 {
-    return (items, ...);
+    return concat(items...);
 }
 
 } // namespace hid::rdf
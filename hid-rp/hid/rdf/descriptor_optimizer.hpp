@@ -0,0 +1,110 @@
+// SPDX-License-Identifier: MPL-2.0
+#pragma once
+
+#include <span>
+#include "hid/rdf/parser.hpp"
+#include "hid/rdf/short_item.hpp"
+
+namespace hid::rdf
+{
+/// @brief  Copies the HID report descriptor without the global items that don't change
+///         the global state, as they repeat the value that is already in effect
+///         (respecting PUSH and POP). The result is semantically equivalent to the input.
+/// @tparam MAX_GLOBAL_STACK_DEPTH: the maximum depth of the global item stack
+/// @param  desc_view: the HID report descriptor's view
+/// @param  buffer: the buffer to copy the kept items to, or an empty span to only calculate
+///         the size of the result
+/// @return the size of the resulting descriptor
+template <std::size_t MAX_GLOBAL_STACK_DEPTH = default_global_stack_depth, typename TIterator>
+constexpr std::size_t remove_redundant_globals(const descriptor_view_base<TIterator>& desc_view,
+                                               std::span<byte_type> buffer = {})
+{
+    std::array<global_item_store, MAX_GLOBAL_STACK_DEPTH> global_stack{};
+    std::size_t depth = 0;
+    std::size_t offset = 0;
+    std::size_t result_size = 0;
+
+    for (auto item_iter = desc_view.begin(); item_iter != desc_view.end(); ++item_iter)
+    {
+        HID_RP_ASSERT(desc_view.is_item_complete(item_iter), ex_invalid_bounds);
+        const auto& this_item = *item_iter;
+        const std::size_t item_size = this_item.size();
+        bool keep = true;
+
+        if (this_item.type() == item_type::GLOBAL)
+        {
+            switch (this_item.global_tag())
+            {
+            case global::tag::PUSH:
+                HID_RP_ASSERT((depth + 1) < global_stack.size(), ex_global_stack_overflow);
+                global_stack[depth + 1] = global_stack[depth];
+                depth++;
+                break;
+
+            case global::tag::POP:
+                HID_RP_ASSERT(depth > 0, ex_pop_unmatched);
+                depth--;
+                break;
+
+            case global::tag::USAGE_PAGE:
+            case global::tag::LOGICAL_MINIMUM:
+            case global::tag::LOGICAL_MAXIMUM:
+            case global::tag::PHYSICAL_MINIMUM:
+            case global::tag::PHYSICAL_MAXIMUM:
+            case global::tag::UNIT_EXPONENT:
+            case global::tag::UNIT:
+            case global::tag::REPORT_SIZE:
+            case global::tag::REPORT_ID:
+            case global::tag::REPORT_COUNT:
+            {
+                // the value must match both as signed and as unsigned,
+                // as the interpretation depends on the item and the data field type
+                const short_item_buffer new_item{this_item};
+                const auto* current = global_stack[depth].get_item(this_item.global_tag());
+                keep = (current == nullptr) or
+                       (current->value_unsigned() != new_item.value_unsigned()) or
+                       (current->value_signed() != new_item.value_signed());
+                global_stack[depth].add_item(new_item);
+                break;
+            }
+
+            default:
+                // reserved tags are left in place
+                break;
+            }
+        }
+
+        if (keep)
+        {
+            if (!buffer.empty())
+            {
+                HID_RP_ASSERT((result_size + item_size) <= buffer.size(),
+                              ex_descriptor_buffer_overflow);
+                for (std::size_t i = 0; i < item_size; ++i)
+                {
+                    buffer[result_size + i] = desc_view.data()[offset + i];
+                }
+            }
+            result_size += item_size;
+        }
+        offset += item_size;
+    }
+    return result_size;
+}
+
+/// @brief  Creates the shortest semantically equivalent HID report descriptor at compile-time,
+///         by removing the global items that don't change the global state,
+///         see @ref remove_redundant_globals.
+/// @tparam Data: the descriptor array, acquired e.g. from a @ref hid::rdf::descriptor call
+/// @tparam MAX_GLOBAL_STACK_DEPTH: the maximum depth of the global item stack
+/// @return The optimized HID report descriptor as an array
+template <auto Data, std::size_t MAX_GLOBAL_STACK_DEPTH = default_global_stack_depth>
+consteval auto make_optimized_descriptor()
+{
+    constexpr auto desc_view = ce_descriptor_view::from_descriptor<Data>();
+    array<remove_redundant_globals<MAX_GLOBAL_STACK_DEPTH>(desc_view)> optimized{};
+    remove_redundant_globals<MAX_GLOBAL_STACK_DEPTH>(desc_view, optimized);
+    return optimized;
+}
+
+} // namespace hid::rdf
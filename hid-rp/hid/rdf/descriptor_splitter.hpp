@@ -0,0 +1,224 @@
+// SPDX-License-Identifier: MPL-2.0
+#pragma once
+
+#include <algorithm>
+#include <span>
+#include "hid/rdf/parser.hpp"
+
+namespace hid::rdf
+{
+/// @brief This class describes a standalone descriptor of a single top-level collection,
+///        split from a descriptor with multiple top-level collections.
+///        The report IDs are kept, so the slice's reports are routed by the original
+///        descriptor's report IDs (see @ref hid::report_routing).
+struct descriptor_slice
+{
+    std::size_t tlc_index{};
+    std::span<const byte_type> prefix{}; ///< the global items in effect at the slice's start
+    std::span<const byte_type> items{};  ///< the slice's items, within the original descriptor
+
+    /// @brief The slice can be used in place when no global items are inherited.
+    [[nodiscard]] constexpr bool is_zero_copy() const { return prefix.empty(); }
+
+    /// @brief The size of the standalone descriptor.
+    [[nodiscard]] constexpr std::size_t size() const { return prefix.size() + items.size(); }
+
+    /// @brief  Materializes the standalone descriptor.
+    /// @param  buffer: the output buffer, it must fit @ref size bytes
+    /// @return The size of the standalone descriptor
+    constexpr std::size_t copy(std::span<byte_type> buffer) const
+    {
+        HID_RP_ASSERT(size() <= buffer.size(), ex_descriptor_buffer_overflow);
+        std::ranges::copy(prefix, buffer.begin());
+        std::ranges::copy(items, buffer.begin() + static_cast<std::ptrdiff_t>(prefix.size()));
+        return size();
+    }
+};
+
+/// @brief The output sizes of @ref split_tlcs.
+struct split_size
+{
+    std::size_t slice_count{};
+    std::size_t prefix_size{}; ///< the total size of the slices' prefixes
+};
+
+/// @brief  Splits a HID report descriptor at its top-level collection boundaries, into slices
+///         that are valid standalone descriptors. The global state that a slice inherits is
+///         materialized as a minimal prefix (respecting PUSH and POP): the global items that
+///         the slice sets before using them are left out.
+///         The items between two top-level collections belong to the latter slice,
+///         the items after the last top-level collection belong to the last slice.
+/// @tparam MAX_GLOBAL_STACK_DEPTH: the maximum depth of the global item stack
+/// @param  desc_view: the HID report descriptor's view
+/// @param  slices: the output storage of the slices, pass an empty span to only calculate
+///         the required sizes
+/// @param  prefix_buffer: the output storage of the slices' prefixes
+/// @return the number of slices and the total size of their prefixes
+/// @throws @ref ex_collection_missing if the descriptor has no top-level collection,
+///         @ref ex_collection_begin_unmatched if the last collection isn't closed
+template <std::size_t MAX_GLOBAL_STACK_DEPTH = default_global_stack_depth, typename TIterator>
+constexpr split_size split_tlcs(const descriptor_view_base<TIterator>& desc_view,
+                                std::span<descriptor_slice> slices = {},
+                                std::span<byte_type> prefix_buffer = {})
+{
+    using global_stack_type = std::array<global_item_store, MAX_GLOBAL_STACK_DEPTH>;
+    constexpr auto global_tag_count = static_cast<std::size_t>(global::tag::REPORT_COUNT) + 1;
+
+    split_size result{};
+    auto write = [&](byte_type byte)
+    {
+        if (!slices.empty())
+        {
+            HID_RP_ASSERT(result.prefix_size < prefix_buffer.size(),
+                          ex_descriptor_buffer_overflow);
+            prefix_buffer[result.prefix_size] = byte;
+        }
+        result.prefix_size++;
+    };
+    auto write_global = [&](global::tag tag, const byte_type* data, std::size_t data_size)
+    {
+        const auto size_code = static_cast<byte_type>((data_size == 4) ? 3U : data_size);
+        write(static_cast<byte_type>((static_cast<byte_type>(tag) << 4) |
+                                     (static_cast<byte_type>(item_type::GLOBAL) << 2) | size_code));
+        for (std::size_t i = 0; i < data_size; ++i)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            write(data[i]);
+        }
+    };
+
+    // emits the global state in effect at the slice's start, and the slice itself
+    auto add_slice = [&](const global_stack_type& stack, std::size_t depth, std::size_t begin,
+                         std::size_t end)
+    {
+        // the globals that the slice sets before using them don't need to be inherited
+        std::array<bool, global_tag_count> overridden{};
+        bool page_used = false;
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        const descriptor_view_base<TIterator> slice_view(desc_view.data() + begin, end - begin);
+        for (const auto& item : slice_view)
+        {
+            if (item.has_tag(main::tag::INPUT) or item.has_tag(main::tag::OUTPUT) or
+                item.has_tag(main::tag::FEATURE) or item.has_tag(global::tag::PUSH) or
+                item.has_tag(global::tag::POP))
+            {
+                break;
+            }
+            if ((item.type() == item_type::GLOBAL) and
+                (item.global_tag() <= global::tag::REPORT_COUNT))
+            {
+                // once overridden, later items of the slice don't change that
+                auto& tag_overridden = overridden[static_cast<std::size_t>(item.global_tag())];
+                tag_overridden = tag_overridden or
+                                 (item.global_tag() != global::tag::USAGE_PAGE) or !page_used;
+            }
+            else if ((item.has_tag(local::tag::USAGE) or
+                      item.has_tag(local::tag::USAGE_MINIMUM) or
+                      item.has_tag(local::tag::USAGE_MAXIMUM)) and
+                     (item.data_size() < sizeof(usage_t)))
+            {
+                page_used = true;
+            }
+        }
+
+        const auto prefix_begin = result.prefix_size;
+        for (std::size_t level = 0; level <= depth; ++level)
+        {
+            if (level > 0)
+            {
+                write_global(global::tag::PUSH, nullptr, 0);
+            }
+            for (std::size_t tag = 0; tag < global_tag_count; ++tag)
+            {
+                const auto* current = stack[level].get_item(static_cast<global::tag>(tag));
+                if ((current == nullptr) or ((level == depth) and overridden[tag]))
+                {
+                    continue;
+                }
+                if (level > 0)
+                {
+                    // the PUSH copies the lower level
+                    const auto* lower = stack[level - 1].get_item(static_cast<global::tag>(tag));
+                    if ((lower != nullptr) and
+                        (lower->value_unsigned() == current->value_unsigned()) and
+                        (lower->data_size() == current->data_size()))
+                    {
+                        continue;
+                    }
+                }
+                write_global(static_cast<global::tag>(tag), current->data(),
+                             current->data_size());
+            }
+        }
+
+        if (result.slice_count < slices.size())
+        {
+            slices[result.slice_count] = {
+                result.slice_count,
+                prefix_buffer.subspan(prefix_begin, result.prefix_size - prefix_begin),
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                {desc_view.data() + begin, end - begin}};
+        }
+        result.slice_count++;
+    };
+
+    global_stack_type global_stack{};
+    std::size_t depth = 0;
+    global_stack_type start_stack{};
+    std::size_t start_depth = 0;
+    std::size_t collection_depth = 0;
+    std::size_t slice_begin = 0;
+    std::size_t offset = 0;
+
+    for (auto item_iter = desc_view.begin(); item_iter != desc_view.end(); ++item_iter)
+    {
+        HID_RP_ASSERT(desc_view.is_item_complete(item_iter), ex_invalid_bounds);
+        const auto& this_item = *item_iter;
+        offset += this_item.size();
+
+        if (this_item.has_tag(global::tag::PUSH))
+        {
+            HID_RP_ASSERT((depth + 1) < global_stack.size(), ex_global_stack_overflow);
+            global_stack[depth + 1] = global_stack[depth];
+            depth++;
+        }
+        else if (this_item.has_tag(global::tag::POP))
+        {
+            HID_RP_ASSERT(depth > 0, ex_pop_unmatched);
+            depth--;
+        }
+        else if ((this_item.type() == item_type::GLOBAL) and
+                 (this_item.global_tag() <= global::tag::REPORT_COUNT))
+        {
+            global_stack[depth].add_item(short_item_buffer{this_item});
+        }
+        else if (this_item.has_tag(main::tag::COLLECTION))
+        {
+            collection_depth++;
+        }
+        else if (this_item.has_tag(main::tag::END_COLLECTION))
+        {
+            HID_RP_ASSERT(collection_depth > 0, ex_collection_end_unmatched);
+            collection_depth--;
+            if (collection_depth == 0)
+            {
+                add_slice(start_stack, start_depth, slice_begin, offset);
+                start_stack = global_stack;
+                start_depth = depth;
+                slice_begin = offset;
+            }
+        }
+    }
+    HID_RP_ASSERT(collection_depth == 0, ex_collection_begin_unmatched);
+    HID_RP_ASSERT(result.slice_count > 0, ex_collection_missing);
+
+    // the trailing items are appended to the last slice, so no item is lost
+    if ((offset > slice_begin) and (result.slice_count <= slices.size()))
+    {
+        auto& last = slices[result.slice_count - 1];
+        last.items = {last.items.data(), last.items.size() + (offset - slice_begin)};
+    }
+    return result;
+}
+
+} // namespace hid::rdf
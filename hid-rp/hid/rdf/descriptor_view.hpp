@@ -147,8 +147,7 @@ class items_view_base
     {
         for (auto it = this->begin(); it != this->end(); ++it)
         {
-            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-            if ((it.ptr_ + (*it).size()) > end_)
+            if (!is_item_complete(it))
             {
                 return false;
             }
@@ -156,6 +155,36 @@ class items_view_base
         return true;
     }
 
+    /// @brief  Verifies that the item at the iterator's position is complete within the view,
+    ///         without accessing any bytes outside of the view.
+    /// @param  it: iterator to an item of this view, before the end
+    /// @return true if the item is complete, false otherwise
+    [[nodiscard]] constexpr bool is_item_complete(const iterator& it) const
+    {
+        constexpr byte_type long_item_prefix = 0xfe;
+        const auto available = static_cast<std::size_t>(end_ - it.ptr_);
+        if (available == 0)
+        {
+            return false;
+        }
+        std::size_t item_size{};
+        if (const auto prefix = *it.ptr_; prefix != long_item_prefix) [[likely]]
+        {
+            item_size = 1 + (((prefix & 3) == 3) ? 4 : (prefix & 3));
+        }
+        else
+        {
+            // long item header: prefix, data size, tag
+            constexpr std::size_t long_item_header_size = 3;
+            if (available < long_item_header_size)
+            {
+                return false;
+            }
+            item_size = long_item_header_size + it.ptr_[1]; // NOLINT
+        }
+        return item_size <= available;
+    }
+
     constexpr items_view_base(const iterator& begin, const iterator& end)
         : begin_(begin.ptr_), end_(end.ptr_)
     {}
@@ -48,6 +48,20 @@ struct ex_item_invalid_tag_type : public exception
     {}
 };
 
+struct ex_item_data_overflow : public exception
+{
+    constexpr ex_item_data_overflow()
+        : exception("item data value doesn't fit in 4 bytes")
+    {}
+};
+
+struct ex_descriptor_buffer_overflow : public exception
+{
+    constexpr ex_descriptor_buffer_overflow()
+        : exception("descriptor buffer too small")
+    {}
+};
+
 struct ex_report_table_invalid_size : public exception
 {
     constexpr ex_report_table_invalid_size()
@@ -62,6 +76,13 @@ struct ex_report_invalid_size : public exception
     {}
 };
 
+struct ex_cache_capacity_zero : public exception
+{
+    constexpr ex_cache_capacity_zero()
+        : exception("cache capacity is zero")
+    {}
+};
+
 /// @brief This class is trying to follow the conventions established by this document:
 /// https://usb.org/sites/default/files/hidpar.pdf
 class parser_exception : public exception
@@ -125,6 +146,14 @@ struct ex_report_crossing_tlc_bounds : public parser_exception
     {}
 };
 
+struct ex_report_count_excess : public parser_exception
+{
+    constexpr ex_report_count_excess()
+        : parser_exception("report count exceeds the parser capacity", global::tag::REPORT_ID,
+                           4)
+    {}
+};
+
 struct ex_item_long : public parser_exception
 {
     constexpr ex_item_long()
@@ -146,6 +175,13 @@ struct ex_invalid_bounds : public parser_exception
     {}
 };
 
+struct ex_section_buffer_overflow : public parser_exception
+{
+    constexpr ex_section_buffer_overflow()
+        : parser_exception("items section exceeds the buffer capacity", 0x02)
+    {}
+};
+
 struct ex_global_stack_overflow : public parser_exception
 {
     constexpr ex_global_stack_overflow()
@@ -32,6 +32,32 @@ constexpr auto logical_limits(TMin min, TMax max)
     return logical_min<DATA_MIN_SIZE>(min), logical_max<DATA_MAX_SIZE>(max);
 }
 
+/// @brief  Creates the logical minimum item with the smallest data size that holds the value.
+/// @tparam VALUE: the logical minimum
+template <auto VALUE>
+constexpr auto logical_min()
+{
+    return logical_min<signed_data_size(VALUE)>(VALUE);
+}
+
+/// @brief  Creates the logical maximum item with the smallest data size that holds the value.
+/// @tparam VALUE: the logical maximum
+template <auto VALUE>
+constexpr auto logical_max()
+{
+    return logical_max<signed_data_size(VALUE)>(VALUE);
+}
+
+/// @brief  Creates the logical limit items, each with the smallest data size that holds it.
+///         The data is sized to be read back as signed, so e.g. 255 takes 2 bytes.
+/// @tparam MIN: the logical minimum
+/// @tparam MAX: the logical maximum
+template <auto MIN, auto MAX>
+constexpr auto logical_limits()
+{
+    return logical_min<MIN>(), logical_max<MAX>();
+}
+
 template <byte_type DATA_SIZE = 4, typename T>
 constexpr auto physical_min(T value)
 {
@@ -56,6 +82,31 @@ constexpr auto physical_limits(TMin min, TMax max)
     return physical_min<DATA_MIN_SIZE>(min), physical_max<DATA_MAX_SIZE>(max);
 }
 
+/// @brief  Creates the physical minimum item with the smallest data size that holds the value.
+/// @tparam VALUE: the physical minimum
+template <auto VALUE>
+constexpr auto physical_min()
+{
+    return physical_min<signed_data_size(VALUE)>(VALUE);
+}
+
+/// @brief  Creates the physical maximum item with the smallest data size that holds the value.
+/// @tparam VALUE: the physical maximum
+template <auto VALUE>
+constexpr auto physical_max()
+{
+    return physical_max<signed_data_size(VALUE)>(VALUE);
+}
+
+/// @brief  Creates the physical limit items, each with the smallest data size that holds it.
+/// @tparam MIN: the physical minimum
+/// @tparam MAX: the physical maximum
+template <auto MIN, auto MAX>
+constexpr auto physical_limits()
+{
+    return physical_min<MIN>(), physical_max<MAX>();
+}
+
 constexpr auto physical_limits_clear()
 {
     return physical_min<0>(0), physical_max<0>(0);
@@ -95,6 +146,22 @@ constexpr auto report_size(T value)
     return short_item<DATA_SIZE>(global::tag::REPORT_SIZE, value);
 }
 
+/// @brief  Creates the report count item with the smallest data size that holds the value.
+/// @tparam VALUE: the report count
+template <auto VALUE>
+constexpr auto report_count()
+{
+    return report_count<unsigned_data_size(VALUE)>(VALUE);
+}
+
+/// @brief  Creates the report size item with the smallest data size that holds the value.
+/// @tparam VALUE: the report size in bits
+template <auto VALUE>
+constexpr auto report_size()
+{
+    return report_size<unsigned_data_size(VALUE)>(VALUE);
+}
+
 template <UsageType T>
 constexpr auto usage_page()
 {
@@ -14,6 +14,16 @@ template <std::size_t DATA_SIZE = 2, UsageType T>
     return short_item<ID_SIZE>(local::tag::USAGE, static_cast<usage_id_t>(value));
 }
 
+/// @brief  Creates the usage item with the smallest data size that holds the usage ID.
+/// @tparam VALUE: the usage, its page is defined by the global usage page
+template <auto VALUE>
+    requires UsageType<decltype(VALUE)>
+[[nodiscard]] constexpr auto usage()
+{
+    constexpr auto ID_SIZE = std::max<byte_type>(unsigned_data_size(VALUE), 1);
+    return short_item<ID_SIZE>(local::tag::USAGE, static_cast<usage_id_t>(VALUE));
+}
+
 /// @note  Extended usage contains the usage page as well, otherwise the global usage page is
 /// considered.
 ///        Extended usage is identified not by tag, but by the data size of the item.
@@ -46,6 +56,19 @@ template <std::size_t DATA_MAX_SIZE = 2, UsageType T>
            short_item<MAX_ID_SIZE>(local::tag::USAGE_MAXIMUM, static_cast<usage_id_t>(max));
 }
 
+/// @brief  Creates the usage limit items, each with the smallest data size that holds it.
+/// @tparam MIN: the usage minimum
+/// @tparam MAX: the usage maximum, of the same usage page
+template <auto MIN, auto MAX>
+    requires UsageType<decltype(MIN)> and std::same_as<decltype(MIN), decltype(MAX)>
+[[nodiscard]] constexpr auto usage_limits()
+{
+    constexpr auto MIN_ID_SIZE = std::max<byte_type>(unsigned_data_size(MIN), 1);
+    constexpr auto MAX_ID_SIZE = std::max<byte_type>(unsigned_data_size(MAX), 1);
+    return short_item<MIN_ID_SIZE>(local::tag::USAGE_MINIMUM, static_cast<usage_id_t>(MIN)),
+           short_item<MAX_ID_SIZE>(local::tag::USAGE_MAXIMUM, static_cast<usage_id_t>(MAX));
+}
+
 template <UsageType T>
 [[nodiscard]] constexpr auto usage_extended_limits(T min, T max)
 {
@@ -65,8 +88,8 @@ template <std::size_t... sz>
 [[nodiscard]] constexpr auto delimited(array<sz>... items)
 {
     static_assert(sizeof...(items) > 0);
-    return short_item<1>(local::tag::DELIMITER, 1), (items, ...),
-           short_item<1>(local::tag::DELIMITER, 0);
+    return concat(short_item<1>(local::tag::DELIMITER, 1), items...,
+                  short_item<1>(local::tag::DELIMITER, 0));
 }
 
 } // namespace hid::rdf
@@ -63,21 +63,29 @@ class global_item_store
     std::array<short_item_buffer, ITEMS_COUNT> items_;
 };
 
-/// @brief Base class for parsing HID report descriptors. It manages the global state,
-/// while subclasses must interpret the the items section at each main item, see
-/// @ref parse_collection_begin, @ref parse_collection_end, and @ref parse_report_data_field.
-template <typename TIterator, typename TItem = typename TIterator::value_type>
-class parser
+/// @brief The default maximum depth of the global item stack, including the current state.
+///        It is shared by the parsers and the descriptor transformations.
+inline constexpr std::size_t default_global_stack_depth = 5;
+
+/// @brief Base class for parsing HID report descriptors, with static dispatch of the item
+/// handlers. It manages the global state, while the TDerived subclass must interpret the items
+/// section at each main item, by hiding @ref parse_collection_begin, @ref parse_collection_end,
+/// and @ref parse_report_data_field with its own methods. As the handlers are resolved
+/// at compile time, they can be inlined into the parsing loop.
+/// @tparam TDerived: the subclass that implements the handlers
+/// @tparam TIterator: iterator type of the descriptor view
+template <typename TDerived, typename TIterator, typename TItem = typename TIterator::value_type>
+class static_parser
 {
   public:
     using item_type = TItem;
     using items_view_type = items_view_base<TIterator>;
     using descriptor_view_type = descriptor_view_base<TIterator>;
 
-    parser(const parser&) = delete;
-    parser& operator=(const parser&) = delete;
-    parser(parser&&) = delete;
-    parser& operator=(parser&&) = delete;
+    static_parser(const static_parser&) = delete;
+    static_parser& operator=(const static_parser&) = delete;
+    static_parser(static_parser&&) = delete;
+    static_parser& operator=(static_parser&&) = delete;
 
     /// @brief The control return value allows early termination of parsing,
     ///        in case all relevant information has been gathered early.
@@ -101,9 +109,7 @@ class parser
         T max;
     };
 
-    constexpr virtual ~parser() = default;
-
-    /// @brief  The override of this method is meant to handle the collection begins of the
+    /// @brief  The TDerived class hides this method to handle the collection begins of the
     /// descriptor.
     /// @param  collection: the type of collection
     /// @param  global_state: the current global items state
@@ -113,7 +119,7 @@ class parser
     /// before this method is called)
     /// @return CONTINUE to continue the parsing until the next main item,
     ///         or BREAK to terminate it early
-    constexpr virtual control
+    constexpr control
     parse_collection_begin([[maybe_unused]] main::collection_type collection,
                            [[maybe_unused]] const global_item_store& global_state,
                            [[maybe_unused]] const items_view_type& main_section,
@@ -122,7 +128,7 @@ class parser
         return control::CONTINUE;
     }
 
-    /// @brief  The override of this method is meant to handle the collection ends of the
+    /// @brief  The TDerived class hides this method to handle the collection ends of the
     /// descriptor.
     /// @param  global_state: the current global items state
     /// @param  main_section: the span of items between the previous and this main item, for local
@@ -130,7 +136,7 @@ class parser
     /// @param  tlc_number: the Top Level Collection index, where this item is found
     /// @return CONTINUE to continue the parsing until the next main item,
     ///         or BREAK to terminate it early
-    constexpr virtual control
+    constexpr control
     parse_collection_end([[maybe_unused]] const global_item_store& global_state,
                          [[maybe_unused]] const items_view_type& main_section,
                          [[maybe_unused]] unsigned tlc_number)
@@ -138,7 +144,7 @@ class parser
         return control::CONTINUE;
     }
 
-    /// @brief  The override of this function is meant to handle the main data field items
+    /// @brief  The TDerived class hides this method to handle the main data field items
     ///         (INPUT/OUTPUT/FEATURE) of the descriptor.
     /// @param  main_item: the current main item that needs parsing
     /// @param  global_state: the current global items state
@@ -147,7 +153,7 @@ class parser
     /// @param  tlc_number: the Top Level Collection index, where this item is found
     /// @return CONTINUE to continue the parsing until the next main item,
     ///         or BREAK to terminate it early
-    constexpr virtual control
+    constexpr control
     parse_report_data_field([[maybe_unused]] const item_type& main_item,
                             [[maybe_unused]] const global_item_store& global_state,
                             [[maybe_unused]] const items_view_type& main_section,
@@ -306,20 +312,35 @@ class parser
         return max_depth;
     }
 
-    /// @brief This method parses the HID report descriptor,
+    /// @brief The default maximum depth of the global item stack, including the current state.
+    static constexpr std::size_t default_global_stack_depth = rdf::default_global_stack_depth;
+
+    /// @brief This method parses the HID report descriptor in a single pass, checking the
+    /// bounds of each item and the global stack depth as it goes,
     /// storing the global items in a fixed-size stack.
+    /// @tparam MAX_GLOBAL_STACK_DEPTH: the maximum depth of the global item stack
     /// @param desc_view: the HID report descriptor's view
     /// @return the iterator to the first item that was not processed
+    /// @note When a handler terminates the parsing early, the rest of the descriptor
+    /// isn't verified.
+    template <std::size_t MAX_GLOBAL_STACK_DEPTH = default_global_stack_depth>
     constexpr TIterator parse_items(descriptor_view_type desc_view)
     {
-        HID_RP_ASSERT(desc_view.has_valid_bounds(), ex_invalid_bounds);
-
-        constexpr std::size_t max_global_stack_depth = 5;
-        HID_RP_ASSERT(global_stack_depth(desc_view) < max_global_stack_depth,
-                      ex_global_stack_overflow);
+        std::array<global_item_store, MAX_GLOBAL_STACK_DEPTH> global_stack{};
+        return fixed_stack_parse(desc_view, global_stack);
+    }
 
-        global_item_store global_stack[max_global_stack_depth]; // NOLINT
-        return fixed_stack_parse(desc_view, std::span(global_stack, max_global_stack_depth));
+    /// @brief This method parses the HID report descriptor in a single pass,
+    /// using the caller provided global item stack.
+    /// @param desc_view: the HID report descriptor's view
+    /// @param global_stack: the stack for global items, its size limits the stack depth
+    /// (see @ref global_stack_depth)
+    /// @return the iterator to the first item that was not processed
+    constexpr TIterator parse_items(descriptor_view_type desc_view,
+                                    std::span<global_item_store> global_stack)
+    {
+        HID_RP_ASSERT(!global_stack.empty(), ex_global_stack_overflow);
+        return fixed_stack_parse(desc_view, global_stack);
     }
 
     /// @brief This method parses the HID report descriptor, using a fixed-size stack for global
@@ -328,18 +349,17 @@ class parser
     /// @param global_stack: the stack for global items, which must be large enough to hold the
     /// maximum depth
     /// @return the iterator to the first item that was not processed
-    // NOLINTNEXTLINE(readability-function-cognitive-complexity)
+    /// @note The bounds of each item are verified before it is accessed.
     constexpr TIterator fixed_stack_parse(const descriptor_view_type& desc_view,
                                           std::span<global_item_store> global_stack)
     {
-        std::size_t global_stack_depth = 0;
+        parse_state state{};
         auto last_section_begin = desc_view.end();
-        unsigned collection_depth = 0;
-        unsigned tlc_number = 0;
         auto last_main_item = desc_view.begin();
 
         for (auto item_iter = desc_view.begin(); item_iter != desc_view.end(); ++item_iter)
         {
+            HID_RP_ASSERT(desc_view.is_item_complete(item_iter), ex_invalid_bounds);
             const item_type& this_item = *item_iter;
 
             // pick up new section after the last one
@@ -348,110 +368,233 @@ class parser
                 last_section_begin = item_iter;
             }
 
-            switch (this_item.type())
+            if (this_item.type() != rdf::item_type::MAIN)
             {
-            case rdf::item_type::MAIN:
+                parse_item(this_item, items_view_type{item_iter, item_iter}, state, global_stack);
+                continue;
+            }
+
+            last_main_item = item_iter;
+            if (parse_item(this_item, items_view_type{last_section_begin, item_iter}, state,
+                           global_stack) != control::CONTINUE)
             {
-                items_view_type last_section{last_section_begin, item_iter};
-                control ctrl = control::BREAK;
-                last_main_item = item_iter;
+                return ++item_iter;
+            }
 
-                // main items is where the magic happens, this is application specific
-                // the local item processing is left for this external parser
-                switch (this_item.main_tag())
-                {
-                case main::tag::INPUT:
-                case main::tag::OUTPUT:
-                case main::tag::FEATURE:
-                    HID_RP_ASSERT(collection_depth > 0, ex_collection_missing);
-                    ctrl = parse_report_data_field(this_item, global_stack[global_stack_depth],
-                                                   last_section, tlc_number);
-                    break;
-
-                case main::tag::COLLECTION:
-                {
-                    auto coll_type = static_cast<main::collection_type>(this_item.value_unsigned());
-                    collection_depth++;
-                    if (collection_depth == 1)
-                    {
-                        tlc_number++;
-                    }
-                    else
-                    {
-                        HID_RP_ASSERT(coll_type != main::collection_type::APPLICATION,
-                                      ex_collection_nested_application);
-                    }
-                    ctrl = parse_collection_begin(coll_type, global_stack[global_stack_depth],
-                                                  last_section, tlc_number);
-                    break;
-                }
+            // when this section is processed, mark the section begin marker as invalid
+            last_section_begin = desc_view.end();
+        }
 
-                case main::tag::END_COLLECTION:
-                    HID_RP_ASSERT(collection_depth > 0, ex_collection_end_unmatched);
-                    collection_depth--;
-                    ctrl = parse_collection_end(global_stack[global_stack_depth], last_section,
-                                                tlc_number);
-                    break;
+        finish_parse(state);
 
-                default:
-                    HID_RP_ASSERT(false, ex_item_unknown);
-                    break;
+        return (last_main_item == desc_view.end()) ? desc_view.end() : ++last_main_item;
+    }
+
+    /// @brief The parsing state that is carried from one item to the next.
+    struct parse_state
+    {
+        std::size_t global_stack_depth{};
+        unsigned collection_depth{};
+        unsigned tlc_number{};
+    };
+
+    /// @brief This method processes a single item of the HID report descriptor:
+    /// it maintains the global state, and calls the main item handlers.
+    /// @param this_item: the item to process
+    /// @param main_section: the span of items between the previous and this main item,
+    /// only used when this is a main item
+    /// @param state: the parsing state, updated by the item
+    /// @param global_stack: the stack for global items
+    /// @return CONTINUE to continue the parsing with the next item, or BREAK to terminate it
+    // NOLINTNEXTLINE(readability-function-cognitive-complexity)
+    constexpr control parse_item(const item_type& this_item, const items_view_type& main_section,
+                                 parse_state& state, std::span<global_item_store> global_stack)
+    {
+        control ctrl = control::CONTINUE;
+        switch (this_item.type())
+        {
+        case rdf::item_type::MAIN:
+        {
+            ctrl = control::BREAK;
+
+            // main items is where the magic happens, this is application specific
+            // the local item processing is left for this external parser
+            switch (this_item.main_tag())
+            {
+            case main::tag::INPUT:
+            case main::tag::OUTPUT:
+            case main::tag::FEATURE:
+                HID_RP_ASSERT(state.collection_depth > 0, ex_collection_missing);
+                ctrl = derived().parse_report_data_field(
+                    this_item, global_stack[state.global_stack_depth], main_section,
+                    state.tlc_number);
+                break;
+
+            case main::tag::COLLECTION:
+            {
+                auto coll_type = static_cast<main::collection_type>(this_item.value_unsigned());
+                state.collection_depth++;
+                if (state.collection_depth == 1)
+                {
+                    state.tlc_number++;
                 }
-                if (ctrl != control::CONTINUE)
+                else
                 {
-                    return ++item_iter;
+                    HID_RP_ASSERT(coll_type != main::collection_type::APPLICATION,
+                                  ex_collection_nested_application);
                 }
+                ctrl = derived().parse_collection_begin(
+                    coll_type, global_stack[state.global_stack_depth], main_section,
+                    state.tlc_number);
+                break;
+            }
 
-                // when this section is processed, mark the section begin marker as invalid
-                last_section_begin = desc_view.end();
+            case main::tag::END_COLLECTION:
+                HID_RP_ASSERT(state.collection_depth > 0, ex_collection_end_unmatched);
+                state.collection_depth--;
+                ctrl = derived().parse_collection_end(global_stack[state.global_stack_depth],
+                                                      main_section, state.tlc_number);
+                break;
+
+            default:
+                HID_RP_ASSERT(false, ex_item_unknown);
                 break;
             }
+            break;
+        }
 
-            case rdf::item_type::GLOBAL:
-                switch (this_item.global_tag())
-                {
-                case global::tag::PUSH:
-                    HID_RP_ASSERT(not this_item.has_data(), ex_push_nonempty);
-                    HID_RP_ASSERT((global_stack_depth + 1) < global_stack.size(),
-                                  ex_global_stack_overflow);
-
-                    // the current state is kept, backed up on the stack
-                    global_stack[global_stack_depth + 1] = global_stack[global_stack_depth];
-                    global_stack_depth++;
-                    break;
-
-                case global::tag::POP:
-                    HID_RP_ASSERT(not this_item.has_data(), ex_pop_nonempty);
-                    HID_RP_ASSERT(global_stack_depth > 0, ex_pop_unmatched);
-
-                    // the last backup is restored
-                    global_stack_depth--;
-                    break;
-
-                default:
-                    HID_RP_ASSERT(this_item.template tag<global::tag>() <=
-                                      global::tag::REPORT_COUNT,
-                                  ex_item_unknown);
-                    global_stack[global_stack_depth].add_item(this_item);
-                    break;
-                }
+        case rdf::item_type::GLOBAL:
+            switch (this_item.global_tag())
+            {
+            case global::tag::PUSH:
+                HID_RP_ASSERT(not this_item.has_data(), ex_push_nonempty);
+                HID_RP_ASSERT((state.global_stack_depth + 1) < global_stack.size(),
+                              ex_global_stack_overflow);
+
+                // the current state is kept, backed up on the stack
+                global_stack[state.global_stack_depth + 1] =
+                    global_stack[state.global_stack_depth];
+                state.global_stack_depth++;
                 break;
 
-            case rdf::item_type::LOCAL:
-                // processed by higher level
+            case global::tag::POP:
+                HID_RP_ASSERT(not this_item.has_data(), ex_pop_nonempty);
+                HID_RP_ASSERT(state.global_stack_depth > 0, ex_pop_unmatched);
+
+                // the last backup is restored
+                state.global_stack_depth--;
                 break;
 
             default:
-                HID_RP_ASSERT(this_item.is_short() == false, ex_item_unknown);
-                HID_RP_ASSERT(this_item.is_short() == true, ex_item_long);
+                HID_RP_ASSERT(this_item.template tag<global::tag>() <= global::tag::REPORT_COUNT,
+                              ex_item_unknown);
+                global_stack[state.global_stack_depth].add_item(this_item);
                 break;
             }
+            break;
+
+        case rdf::item_type::LOCAL:
+            // processed by higher level
+            break;
+
+        default:
+            HID_RP_ASSERT(this_item.is_short() == false, ex_item_unknown);
+            HID_RP_ASSERT(this_item.is_short() == true, ex_item_long);
+            break;
         }
+        return ctrl;
+    }
+
+    /// @brief Verifies that all opened scopes are closed at the end of the descriptor.
+    /// @param state: the parsing state after the last item
+    constexpr static void finish_parse(const parse_state& state)
+    {
+        HID_RP_ASSERT(state.global_stack_depth == 0, ex_push_unmatched);
+        HID_RP_ASSERT(state.collection_depth == 0, ex_collection_begin_unmatched);
+    }
 
-        HID_RP_ASSERT(global_stack_depth == 0, ex_push_unmatched);
-        HID_RP_ASSERT(collection_depth == 0, ex_collection_begin_unmatched);
+  protected:
+    constexpr static_parser() = default;
+    constexpr ~static_parser() = default;
 
-        return (last_main_item == desc_view.end()) ? desc_view.end() : ++last_main_item;
+  private:
+    constexpr TDerived& derived() { return static_cast<TDerived&>(*this); }
+};
+
+/// @brief Base class for parsing HID report descriptors, with virtual item handlers.
+/// It manages the global state, while subclasses must interpret the items section at each main
+/// item, see @ref parse_collection_begin, @ref parse_collection_end, and
+/// @ref parse_report_data_field.
+/// This is a thin adapter on top of @ref static_parser, for subclasses that prefer overriding.
+template <typename TIterator, typename TItem = typename TIterator::value_type>
+class parser : public static_parser<parser<TIterator, TItem>, TIterator, TItem>
+{
+    using base = static_parser<parser<TIterator, TItem>, TIterator, TItem>;
+
+  public:
+    using item_type = typename base::item_type;
+    using items_view_type = typename base::items_view_type;
+    using descriptor_view_type = typename base::descriptor_view_type;
+    using control = typename base::control;
+
+    parser(const parser&) = delete;
+    parser& operator=(const parser&) = delete;
+    parser(parser&&) = delete;
+    parser& operator=(parser&&) = delete;
+
+    constexpr virtual ~parser() = default;
+
+    /// @brief  The override of this method is meant to handle the collection begins of the
+    /// descriptor.
+    /// @param  collection: the type of collection
+    /// @param  global_state: the current global items state
+    /// @param  main_section: the span of items between the previous and this main item, for local
+    /// items parsing
+    /// @param  tlc_number: the Top Level Collection index, where this item is found (incremented
+    /// before this method is called)
+    /// @return CONTINUE to continue the parsing until the next main item,
+    ///         or BREAK to terminate it early
+    constexpr virtual control
+    parse_collection_begin([[maybe_unused]] main::collection_type collection,
+                           [[maybe_unused]] const global_item_store& global_state,
+                           [[maybe_unused]] const items_view_type& main_section,
+                           [[maybe_unused]] unsigned tlc_number)
+    {
+        return control::CONTINUE;
+    }
+
+    /// @brief  The override of this method is meant to handle the collection ends of the
+    /// descriptor.
+    /// @param  global_state: the current global items state
+    /// @param  main_section: the span of items between the previous and this main item, for local
+    /// items parsing
+    /// @param  tlc_number: the Top Level Collection index, where this item is found
+    /// @return CONTINUE to continue the parsing until the next main item,
+    ///         or BREAK to terminate it early
+    constexpr virtual control
+    parse_collection_end([[maybe_unused]] const global_item_store& global_state,
+                         [[maybe_unused]] const items_view_type& main_section,
+                         [[maybe_unused]] unsigned tlc_number)
+    {
+        return control::CONTINUE;
+    }
+
+    /// @brief  The override of this function is meant to handle the main data field items
+    ///         (INPUT/OUTPUT/FEATURE) of the descriptor.
+    /// @param  main_item: the current main item that needs parsing
+    /// @param  global_state: the current global items state
+    /// @param  main_section: the span of items between the previous and this main item, for local
+    /// items parsing
+    /// @param  tlc_number: the Top Level Collection index, where this item is found
+    /// @return CONTINUE to continue the parsing until the next main item,
+    ///         or BREAK to terminate it early
+    constexpr virtual control
+    parse_report_data_field([[maybe_unused]] const item_type& main_item,
+                            [[maybe_unused]] const global_item_store& global_state,
+                            [[maybe_unused]] const items_view_type& main_section,
+                            [[maybe_unused]] unsigned tlc_number)
+    {
+        return control::CONTINUE;
     }
 
   protected:
@@ -468,15 +611,16 @@ template <typename TIterator>
 constexpr usage_t get_application_usage_id(const descriptor_view_base<TIterator>& desc_view)
 {
     /// @brief Internal class that implements the parsing logic for the specific task.
-    struct application_usage_id_parser : public parser<TIterator>
+    struct application_usage_id_parser
+        : public static_parser<application_usage_id_parser, TIterator>
     {
-        using base = parser<TIterator>;
+        using base = static_parser<application_usage_id_parser, TIterator>;
         using items_view_type = base::items_view_type;
         using descriptor_view_type = base::descriptor_view_type;
         using control = base::control;
 
         constexpr application_usage_id_parser(const descriptor_view_type& desc_view)
-            : parser<TIterator>()
+            : base()
         {
             base::parse_items(desc_view);
         }
@@ -484,7 +628,7 @@ constexpr usage_t get_application_usage_id(const descriptor_view_base<TIterator>
         constexpr control parse_collection_begin([[maybe_unused]] main::collection_type collection,
                                                  const global_item_store& global_state,
                                                  const items_view_type& main_section,
-                                                 [[maybe_unused]] unsigned tlc_number) override
+                                                 [[maybe_unused]] unsigned tlc_number)
         {
             collection_depth_++;
             if (collection_depth_ == 1)
@@ -505,7 +649,7 @@ constexpr usage_t get_application_usage_id(const descriptor_view_base<TIterator>
         constexpr control
         parse_collection_end([[maybe_unused]] const global_item_store& global_state,
                              [[maybe_unused]] const items_view_type& main_section,
-                             [[maybe_unused]] unsigned tlc_number) override
+                             [[maybe_unused]] unsigned tlc_number)
         {
             collection_depth_--;
             if (collection_depth_ == 0)
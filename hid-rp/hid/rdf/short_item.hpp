@@ -2,6 +2,7 @@
 #pragma once
 
 #include <bit>
+#include <limits>
 #include "hid/rdf/item.hpp"
 
 namespace hid::rdf
@@ -23,16 +24,7 @@ class [[nodiscard]] array : public std::array<byte_type, SIZE>
     template <std::size_t SIZE_2>
     constexpr array<SIZE + SIZE_2> operator,(array<SIZE_2> a2)
     {
-        array<SIZE + SIZE_2> concat = {0};
-        for (std::size_t i = 0; i < SIZE; ++i)
-        {
-            concat[i] = (*this)[i];
-        }
-        for (std::size_t i = 0; i < SIZE_2; ++i)
-        {
-            concat[SIZE + i] = a2[i];
-        }
-        return concat;
+        return concat(*this, a2);
     }
 
     template <std::size_t Repeats>
@@ -42,6 +34,29 @@ class [[nodiscard]] array : public std::array<byte_type, SIZE>
     }
 };
 
+/// @brief  Concatenates all input arrays into a single one, copying each byte exactly once.
+///         Chaining the comma operator copies the accumulated result at every step instead,
+///         which makes building large descriptors quadratic in constant evaluation.
+/// @tparam SIZES: deduced template parameter
+/// @param  items: the arrays to concatenate, in order
+/// @return The concatenated array
+template <std::size_t... SIZES>
+constexpr array<(SIZES + ... + 0)> concat(const array<SIZES>&... items)
+{
+    array<(SIZES + ... + 0)> result{};
+    std::size_t offset = 0;
+    auto append = [&result, &offset](const auto& item)
+    {
+        for (std::size_t i = 0; i < item.size(); ++i)
+        {
+            result[offset + i] = item[i];
+        }
+        offset += item.size();
+    };
+    (append(items), ...);
+    return result;
+}
+
 /// @brief This class stores exactly one HID report descriptor item.
 template <byte_type DATA_SIZE>
 class short_item : public array<1 + DATA_SIZE>
@@ -115,4 +130,58 @@ class short_item : public array<1 + DATA_SIZE>
     }
 };
 
+/// @brief  Calculates the smallest short item data size that holds the value,
+///         when the item data is read back as a signed integer.
+/// @param  value: the item's data value
+/// @return The item data size in bytes: 0, 1, 2 or 4
+template <typename T>
+[[nodiscard]] constexpr byte_type signed_data_size(T value)
+{
+    auto v = static_cast<std::int64_t>(value);
+    // a larger value would be read back as negative
+    HID_RP_ASSERT((v >= std::numeric_limits<std::int32_t>::min()) and
+                      (v <= std::numeric_limits<std::int32_t>::max()),
+                  ex_item_data_overflow);
+    if (v == 0)
+    {
+        return 0;
+    }
+    if ((v >= std::numeric_limits<std::int8_t>::min()) and
+        (v <= std::numeric_limits<std::int8_t>::max()))
+    {
+        return 1;
+    }
+    if ((v >= std::numeric_limits<std::int16_t>::min()) and
+        (v <= std::numeric_limits<std::int16_t>::max()))
+    {
+        return 2;
+    }
+    return 4;
+}
+
+/// @brief  Calculates the smallest short item data size that holds the value,
+///         when the item data is read back as an unsigned integer.
+/// @param  value: the item's data value
+/// @return The item data size in bytes: 0, 1, 2 or 4
+template <typename T>
+[[nodiscard]] constexpr byte_type unsigned_data_size(T value)
+{
+    auto v = static_cast<std::int64_t>(value);
+    HID_RP_ASSERT((v >= 0) and (v <= std::numeric_limits<std::uint32_t>::max()),
+                  ex_item_data_overflow);
+    if (v == 0)
+    {
+        return 0;
+    }
+    if (v <= std::numeric_limits<std::uint8_t>::max())
+    {
+        return 1;
+    }
+    if (v <= std::numeric_limits<std::uint16_t>::max())
+    {
+        return 2;
+    }
+    return 4;
+}
+
 } // namespace hid::rdf
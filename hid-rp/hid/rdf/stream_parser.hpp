@@ -0,0 +1,120 @@
+// SPDX-License-Identifier: MPL-2.0
+#pragma once
+
+#include <algorithm>
+#include "hid/rdf/parser.hpp"
+
+namespace hid::rdf
+{
+/// @brief Push-style variant of @ref parser, for parsing HID report descriptors while they are
+/// being received in chunks. The parsing state is kept between chunks, and the same
+/// @ref parse_collection_begin, @ref parse_collection_end, and @ref parse_report_data_field
+/// handlers are called as soon as a main item is complete.
+/// Only the items since the last main item are buffered, instead of the whole descriptor.
+/// @tparam TIterator: iterator type of the items section views passed to the handlers
+/// @tparam SECTION_CAPACITY: the maximum size of the items between two main items in bytes
+/// @tparam GLOBAL_STACK_DEPTH: the maximum depth of the global item stack, including the
+/// current state
+template <typename TIterator = reinterpret_iterator, std::size_t SECTION_CAPACITY = 256,
+          std::size_t GLOBAL_STACK_DEPTH = 5>
+class stream_parser : public parser<TIterator>
+{
+    using base = parser<TIterator>;
+
+  public:
+    using control = typename base::control;
+    using item_type = typename base::item_type;
+    using items_view_type = typename base::items_view_type;
+
+    /// @brief  Parses the next chunk of the descriptor.
+    /// @param  chunk: the next bytes of the descriptor, items may be split between chunks
+    /// @return CONTINUE if more chunks can be parsed, or BREAK if a handler terminated parsing
+    constexpr control push(std::span<const byte_type> chunk)
+    {
+        while (!chunk.empty() and !stopped_)
+        {
+            if (pending_received_ == 0)
+            {
+                pending_size_ = item_size(chunk.front());
+                HID_RP_ASSERT(section_size_ + pending_size_ <= section_.size(),
+                              ex_section_buffer_overflow);
+            }
+            auto copy_size = std::min(pending_size_ - pending_received_, chunk.size());
+            std::copy_n(chunk.begin(), copy_size,
+                        std::next(section_.begin(),
+                                  static_cast<std::ptrdiff_t>(section_size_ + pending_received_)));
+            pending_received_ += copy_size;
+            chunk = chunk.subspan(copy_size);
+
+            if (pending_received_ == pending_size_)
+            {
+                stopped_ = parse_pending_item() != control::CONTINUE;
+            }
+        }
+        return stopped_ ? control::BREAK : control::CONTINUE;
+    }
+
+    /// @brief Completes the parsing at the end of the descriptor,
+    /// verifying that the last item is complete, and all opened scopes are closed.
+    constexpr void finish()
+    {
+        HID_RP_ASSERT(pending_received_ == 0, ex_invalid_bounds);
+        if (!stopped_)
+        {
+            base::finish_parse(state_);
+        }
+    }
+
+    /// @brief Indicates whether a handler has terminated the parsing.
+    [[nodiscard]] constexpr bool stopped() const { return stopped_; }
+
+  protected:
+    constexpr stream_parser() = default;
+
+  private:
+    constexpr static std::size_t item_size(byte_type prefix)
+    {
+        // long items are not supported by the parser either
+        constexpr byte_type long_item_prefix = 0xfe;
+        HID_RP_ASSERT(prefix != long_item_prefix, ex_item_long);
+        return 1 + (((prefix & 3) == 3) ? 4 : (prefix & 3));
+    }
+
+    constexpr control parse_pending_item()
+    {
+        const auto* section_begin = section_.data();
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        const auto* item_ptr = section_begin + section_size_;
+        auto item_iter = TIterator(item_ptr);
+        const item_type& this_item = *item_iter;
+
+        control ctrl{};
+        if (this_item.type() == rdf::item_type::MAIN)
+        {
+            ctrl = base::parse_item(this_item,
+                                    items_view_type{TIterator(section_begin), item_iter}, state_,
+                                    global_stack_);
+            // the section is processed, start a new one
+            section_size_ = 0;
+        }
+        else
+        {
+            ctrl = base::parse_item(this_item, items_view_type{item_iter, item_iter}, state_,
+                                    global_stack_);
+            section_size_ += pending_size_;
+        }
+        pending_size_ = 0;
+        pending_received_ = 0;
+        return ctrl;
+    }
+
+    std::array<byte_type, SECTION_CAPACITY> section_{};
+    std::array<global_item_store, GLOBAL_STACK_DEPTH> global_stack_{};
+    typename base::parse_state state_{};
+    std::size_t section_size_{};
+    std::size_t pending_size_{};
+    std::size_t pending_received_{};
+    bool stopped_{};
+};
+
+} // namespace hid::rdf
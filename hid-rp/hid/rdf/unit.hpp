@@ -117,6 +117,16 @@ class [[nodiscard]] exponent : public short_item<1>
     {}
 };
 
+/// @brief  Creates the unit exponent item, omitting the data when the exponent is zero.
+/// @tparam EXPONENT: the ten's exponent
+template <std::int8_t EXPONENT>
+[[nodiscard]] constexpr auto unit_exponent()
+{
+    static_assert((EXPONENT >= -8) and (EXPONENT <= 7));
+    return short_item<(EXPONENT == 0) ? 0 : 1>(global::tag::UNIT_EXPONENT,
+                                               static_cast<byte_type>(EXPONENT & 0xf));
+}
+
 /// @brief  Template for exact units. Each unit is defined by its code and its base exponent
 ///         (as some of the default SI units have non-zero base exponent).
 ///         Creating a derived object will therefore contain a unit and a unit exponent item.
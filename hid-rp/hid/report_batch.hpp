@@ -0,0 +1,81 @@
+// SPDX-License-Identifier: MPL-2.0
+#pragma once
+
+#include "hid/bit_field.hpp"
+#include "hid/report_layout.hpp"
+
+namespace hid
+{
+/// @brief This class decodes a batch of reports with the same selector at once,
+///        into structure-of-arrays buffers: each field element has its own column of values,
+///        with one value per report.
+///        The columns are ordered as the non-padding fields and their elements in the layout.
+///        Each column is decoded by the @ref hid::bit_field_kernel matching its shape.
+class report_batch_decoder
+{
+  public:
+    /// @brief Creates a decoder for a single report's fields.
+    /// @param fields: the report's fields, acquired from @ref report_layout::fields(selector);
+    ///        the field sizes must not exceed 32 bits
+    constexpr explicit report_batch_decoder(report_layout::fields_view fields)
+        : fields_(fields)
+    {
+        for (const auto& field : fields_)
+        {
+            HID_RP_ASSERT(field.is_padding() or (field.bit_size <= 32), ex_report_invalid_size);
+            if (!field.is_padding())
+            {
+                column_count_ += field.count;
+            }
+        }
+    }
+
+    /// @brief The number of value columns that a decoded batch consists of.
+    [[nodiscard]] constexpr std::size_t column_count() const { return column_count_; }
+
+    /// @brief The size of a single report in bytes, including the report ID (if used).
+    [[nodiscard]] constexpr std::size_t report_size() const
+    {
+        return fields_.empty() ? 0 : (fields_.back().bit_end() / 8);
+    }
+
+    /// @brief  Decodes a batch of reports.
+    /// @param  reports: the raw reports, stored consecutively with a fixed stride
+    /// @param  stride: the distance of consecutive reports in bytes, at least @ref report_size
+    /// @param  columns: the output buffer, column N of the values is stored at
+    ///         [N * report count, (N + 1) * report count)
+    /// @return The number of decoded reports
+    constexpr std::size_t decode(std::span<const std::uint8_t> reports, std::size_t stride,
+                                 std::span<std::int32_t> columns) const
+    {
+        HID_RP_ASSERT(stride >= report_size() and stride > 0, ex_report_invalid_size);
+        const auto report_count = reports.size() / stride;
+        HID_RP_ASSERT(columns.size() >= column_count() * report_count,
+                      ex_report_table_invalid_size);
+
+        auto column = columns;
+        for (const auto& field : fields_)
+        {
+            if (field.is_padding())
+            {
+                continue;
+            }
+            for (std::size_t i = 0; i < field.count; ++i)
+            {
+                // the same element of each report forms an array with the report stride
+                extract(reports,
+                        bit_field_array{field.element_bit_offset(i), field.bit_size, stride * 8,
+                                        report_count, field.is_signed()},
+                        column);
+                column = column.subspan(report_count);
+            }
+        }
+        return report_count;
+    }
+
+  private:
+    report_layout::fields_view fields_{};
+    std::size_t column_count_{};
+};
+
+} // namespace hid
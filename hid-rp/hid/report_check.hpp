@@ -0,0 +1,89 @@
+// SPDX-License-Identifier: MPL-2.0
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <type_traits>
+#include "hid/report_layout.hpp"
+#include "hid/report_protocol.hpp"
+
+namespace hid
+{
+/// @brief  Gets the size of a report, as defined by the descriptor.
+/// @tparam Data: the descriptor array, acquired e.g. from a @ref hid::rdf::descriptor call
+/// @param  select: the report selector
+/// @return The size of the report in bytes, including the report ID, or 0 if not defined
+template <auto Data>
+consteval std::size_t descriptor_report_size(report::selector select)
+{
+    constexpr auto table = make_report_properties_table<Data>();
+    const auto* it = std::ranges::find(table, select, &report::properties::selector);
+    return (it != table.end()) ? it->size : 0;
+}
+
+/// @brief  Locates a data member within the object representation of its report structure.
+/// @tparam T: the report structure, it must be trivially copyable and have no padding bytes
+/// @param  member: the data member's pointer
+/// @return The offset of the member in bytes
+template <typename T, typename TMember>
+consteval std::size_t member_byte_offset(TMember T::*member)
+{
+    static_assert(std::is_trivially_copyable_v<T> and std::is_trivially_copyable_v<TMember>);
+    using object_bytes = std::array<std::uint8_t, sizeof(T)>;
+    using member_bytes = std::array<std::uint8_t, sizeof(TMember)>;
+
+    T probe{};
+    const auto before = std::bit_cast<object_bytes>(probe);
+    auto inverted = std::bit_cast<member_bytes>(probe.*member);
+    for (auto& byte : inverted)
+    {
+        byte = static_cast<std::uint8_t>(~byte);
+    }
+    probe.*member = std::bit_cast<TMember>(inverted);
+    const auto after = std::bit_cast<object_bytes>(probe);
+    return static_cast<std::size_t>(std::ranges::mismatch(before, after).in1 - before.begin());
+}
+
+/// @brief  Verifies at compile-time that a report structure matches the descriptor,
+///         so it's neither truncated nor overlong when it's sent.
+///         Use it as static_assert(hid::report_matches_descriptor<Data, T>());
+/// @tparam Data: the descriptor array, acquired e.g. from a @ref hid::rdf::descriptor call
+/// @tparam T: the report structure
+/// @return true, otherwise the compilation fails
+template <auto Data, report::Data T>
+consteval bool report_matches_descriptor()
+{
+    constexpr auto size = descriptor_report_size<Data>(T::selector());
+    static_assert(size > 0, "the descriptor doesn't define the report's selector");
+    static_assert(size == sizeof(T), "the report's size doesn't match the descriptor");
+    return true;
+}
+
+/// @brief  Verifies at compile-time that a byte aligned data member of a report structure
+///         is located where the descriptor defines the usage's element.
+///         Use it as static_assert(hid::field_matches_descriptor<Data, T, USAGE>(&T::member));
+/// @tparam Data: the descriptor array, acquired e.g. from a @ref hid::rdf::descriptor call
+/// @tparam T: the report structure
+/// @tparam USAGE: the usage of the (first) element that the member stores
+/// @param  member: the data member's pointer, its size must be a multiple of the element size
+/// @return true if the member's offset and size match the descriptor
+template <auto Data, report::Data T, auto USAGE, typename TMember>
+consteval bool field_matches_descriptor(TMember T::*member)
+{
+    const report_layout layout{report_layout_table<Data>};
+    const usage_t usage{USAGE};
+    const auto* field = layout.find(T::selector(), usage);
+    if ((field == nullptr) or ((field->bit_size % 8) != 0))
+    {
+        return false;
+    }
+    const auto bit_offset =
+        field->is_variable() ? field->element_bit_offset(field->usage_index(usage))
+                             : field->bit_offset;
+    return ((bit_offset % 8) == 0) and ((bit_offset / 8) == member_byte_offset(member)) and
+           (((sizeof(TMember) * 8) % field->bit_size) == 0) and
+           ((bit_offset + sizeof(TMember) * 8) <= (8 * sizeof(T)));
+}
+
+} // namespace hid
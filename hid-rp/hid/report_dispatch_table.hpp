@@ -0,0 +1,108 @@
+// SPDX-License-Identifier: MPL-2.0
+#pragma once
+
+#include "hid/report_layout.hpp"
+
+namespace hid
+{
+/// @brief This class maps each report selector to its section of the report layout
+///        and its expected byte size, so that a received raw report's layout is found
+///        with a single array lookup.
+class report_dispatch_table
+{
+  public:
+    struct entry
+    {
+        std::uint16_t first_field{};
+        std::uint16_t field_count{};
+        std::uint16_t size{}; ///< the report size in bytes, including the report ID (if used)
+
+        [[nodiscard]] constexpr bool valid() const { return size > 0; }
+    };
+
+    constexpr report_dispatch_table() = default;
+
+    /// @brief Builds the dispatch table from the compiled report layout.
+    /// @param layout: the report layout, its storage must outlive this object
+    constexpr explicit report_dispatch_table(const report_layout& layout)
+        : fields_(layout.fields())
+    {
+        for (std::size_t i = 0; i < fields_.size();)
+        {
+            auto select = fields_[i].selector;
+            auto report_fields = layout.fields(select);
+            auto& report_entry = entry_by_selector(select);
+            report_entry.first_field = static_cast<std::uint16_t>(i);
+            report_entry.field_count = static_cast<std::uint16_t>(report_fields.size());
+            report_entry.size = static_cast<std::uint16_t>(report_fields.back().bit_end() / 8);
+            report_ids_used_ = report_ids_used_ or (select.id() > 0);
+            i += report_fields.size();
+        }
+    }
+
+    [[nodiscard]] constexpr bool uses_report_ids() const { return report_ids_used_; }
+
+    /// @brief  Looks up a report by its selector.
+    /// @param  select: the report selector, its type must be valid
+    /// @return The dispatch entry of the report, which is invalid if the report isn't defined
+    [[nodiscard]] constexpr const entry& find(report::selector select) const
+    {
+        return entry_by_selector(select);
+    }
+
+    /// @brief  Gets the fields of a report dispatch entry.
+    /// @param  report_entry: the entry returned by @ref find
+    /// @return The fields of the report, ordered by offset
+    [[nodiscard]] constexpr report_layout::fields_view fields(const entry& report_entry) const
+    {
+        return fields_.subspan(report_entry.first_field, report_entry.field_count);
+    }
+
+    /// @brief  Looks up the layout of a received raw report.
+    /// @param  type: the report's type
+    /// @param  data: the raw report, starting with the report ID if report IDs are used
+    /// @return The fields of the report, or an empty view if the report is unknown or truncated
+    [[nodiscard]] constexpr report_layout::fields_view
+    fields(report::type type, std::span<const std::uint8_t> data) const
+    {
+        if (data.empty())
+        {
+            return {};
+        }
+        const auto& report_entry =
+            find(report::selector(type, report_ids_used_ ? data.front() : 0));
+        if (data.size() < report_entry.size)
+        {
+            return {};
+        }
+        return fields(report_entry);
+    }
+
+  private:
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-constant-array-index)
+    [[nodiscard]] constexpr entry& entry_by_selector(report::selector select)
+    {
+        return entries_[static_cast<std::size_t>(select.type()) - 1][select.id()];
+    }
+    [[nodiscard]] constexpr const entry& entry_by_selector(report::selector select) const
+    {
+        return entries_[static_cast<std::size_t>(select.type()) - 1][select.id()];
+    }
+    // NOLINTEND(cppcoreguidelines-pro-bounds-constant-array-index)
+
+    report_layout::fields_view fields_{};
+    std::array<std::array<entry, report::id::max() + 1>, 3> entries_{};
+    bool report_ids_used_{};
+};
+
+/// @brief  Create the report dispatch table of a descriptor in compile-time.
+/// @tparam Data: the descriptor array, acquired e.g. from a @ref hid::rdf::descriptor call
+/// @return The dispatch table, referring to the static @ref hid::report_layout_table of the
+///         descriptor
+template <auto Data>
+consteval auto make_report_dispatch_table()
+{
+    return report_dispatch_table(report_layout(report_layout_table<Data>));
+}
+
+} // namespace hid
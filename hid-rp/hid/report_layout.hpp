@@ -0,0 +1,515 @@
+// SPDX-License-Identifier: MPL-2.0
+#pragma once
+
+#include <algorithm>
+#include <span>
+#include "hid/bit_field.hpp"
+#include "hid/report_protocol.hpp"
+
+namespace hid
+{
+/// @brief This class describes a contiguous section of a report, where all elements share
+///        the same properties, and the same usage or a consecutive range of usages.
+///        Report data fields (main items) with multiple usages are split into multiple fields.
+struct report_field
+{
+    report::selector selector{};
+    std::uint16_t bit_offset{}; ///< offset from the start of the report, including the report ID
+    std::uint16_t bit_size{};   ///< the REPORT_SIZE of each element
+    std::uint16_t count{};      ///< the number of elements
+    std::uint16_t flags{};      ///< the main item's @ref rdf::main::data_field_flag values
+    usage_t usage_min{nullusage};
+    usage_t usage_max{nullusage};
+    std::int32_t logical_min{};
+    std::int32_t logical_max{};
+    std::int32_t physical_min{};
+    std::int32_t physical_max{};
+
+    constexpr bool operator==(const report_field& other) const = default;
+    constexpr bool operator!=(const report_field& other) const = default;
+
+    [[nodiscard]] constexpr bool is_constant() const
+    {
+        return (flags & rdf::main::data_field_flag::CONSTANT) != 0;
+    }
+    [[nodiscard]] constexpr bool is_variable() const
+    {
+        return (flags & rdf::main::data_field_flag::VARIABLE) != 0;
+    }
+    [[nodiscard]] constexpr bool is_array() const { return !is_variable(); }
+    [[nodiscard]] constexpr bool is_relative() const
+    {
+        return (flags & rdf::main::data_field_flag::RELATIVE) != 0;
+    }
+    /// @brief Fields without any usage are padding bits.
+    [[nodiscard]] constexpr bool is_padding() const { return usage_min == nullusage; }
+    /// @brief The values need to be sign extended when the logical minimum is negative.
+    [[nodiscard]] constexpr bool is_signed() const { return logical_min < 0; }
+
+    [[nodiscard]] constexpr std::size_t bit_length() const
+    {
+        return static_cast<std::size_t>(bit_size) * count;
+    }
+    [[nodiscard]] constexpr std::size_t bit_end() const { return bit_offset + bit_length(); }
+    /// @brief  Locates an element of the field.
+    /// @param  index: the element index, must be less than count
+    /// @return The element's bit offset within the report
+    [[nodiscard]] constexpr std::size_t element_bit_offset(std::size_t index) const
+    {
+        return bit_offset + index * bit_size;
+    }
+
+    /// @brief  Checks whether the usage is assigned to this field.
+    ///         For array fields this means that the usage is a valid value of the elements.
+    [[nodiscard]] constexpr bool has_usage(usage_t usage) const
+    {
+        return !is_padding() and (usage >= usage_min) and (usage <= usage_max);
+    }
+    /// @brief  Gets the usage of a variable field's element.
+    /// @param  index: the element index, must be less than count
+    /// @return The usage of the element (the last usage is repeated for the remaining elements)
+    [[nodiscard]] constexpr usage_t usage(std::size_t index) const
+    {
+        if (is_padding())
+        {
+            return nullusage;
+        }
+        return usage_t(std::min(usage_min + static_cast<usage_t::type>(index),
+                                static_cast<usage_t::type>(usage_max)));
+    }
+    /// @brief  Gets the element index of a usage in a variable field.
+    /// @param  usage: the usage to look up, must be assigned to this field
+    /// @return The index of the element assigned to the usage
+    [[nodiscard]] constexpr std::size_t usage_index(usage_t usage) const
+    {
+        return static_cast<std::size_t>(usage - usage_min);
+    }
+
+    /// @brief The elements of the field, for accessing them with the bit field kernels.
+    [[nodiscard]] constexpr bit_field_array elements() const
+    {
+        return {bit_offset, bit_size, bit_size, count, is_signed()};
+    }
+};
+
+/// @brief This class is a view of a compiled report layout: a flat table of @ref report_field
+///        elements, sorted by report selector and bit offset. It allows decoding reports
+///        without parsing the HID report descriptor again.
+class report_layout
+{
+  public:
+    using fields_view = std::span<const report_field>;
+    using iterator = fields_view::iterator;
+
+    constexpr report_layout() = default;
+    constexpr explicit report_layout(fields_view fields)
+        : fields_(fields)
+    {}
+
+    [[nodiscard]] constexpr fields_view fields() const { return fields_; }
+    [[nodiscard]] constexpr iterator begin() const { return fields_.begin(); }
+    [[nodiscard]] constexpr iterator end() const { return fields_.end(); }
+    [[nodiscard]] constexpr std::size_t size() const { return fields_.size(); }
+    [[nodiscard]] constexpr bool empty() const { return fields_.empty(); }
+
+    /// @brief  Gets the fields of a single report.
+    /// @param  select: the report selector
+    /// @return The contiguous section of the fields that belong to the report, ordered by offset
+    [[nodiscard]] constexpr fields_view fields(report::selector select) const
+    {
+        auto key = static_cast<std::uint16_t>(select);
+        auto first = std::ranges::lower_bound(fields_, key, {}, selector_key);
+        auto last = std::ranges::upper_bound(first, fields_.end(), key, {}, selector_key);
+        return {first, last};
+    }
+
+    /// @brief  Finds the field that a usage is assigned to within a report.
+    /// @param  select: the report selector
+    /// @param  usage: the usage to look up
+    /// @return Pointer to the first field containing the usage, or nullptr if not found
+    [[nodiscard]] constexpr const report_field* find(report::selector select, usage_t usage) const
+    {
+        auto report_fields = fields(select);
+        auto it = std::ranges::find_if(report_fields,
+                                       [usage](const report_field& field)
+                                       { return field.has_usage(usage); });
+        return (it != report_fields.end()) ? &(*it) : nullptr;
+    }
+
+    /// @brief  Counts the elements that a usage is assigned to within a report.
+    /// @param  select: the report selector
+    /// @param  usage: the usage to look up
+    /// @return The number of variable elements with the usage, plus the number of array fields
+    ///         that can select the usage
+    [[nodiscard]] constexpr std::size_t usage_count(report::selector select, usage_t usage) const
+    {
+        std::size_t count = 0;
+        for (const auto& field : fields(select))
+        {
+            if (!field.has_usage(usage))
+            {
+                continue;
+            }
+            // the last usage is repeated for the remaining elements of a variable main item
+            count += (field.is_array() or (field.usage_min != field.usage_max)) ? 1U : field.count;
+        }
+        return count;
+    }
+
+    /// @brief  Calculates the byte size of a report.
+    /// @param  select: the report selector
+    /// @return The size of the report in bytes, including the report ID, or 0 if not found
+    [[nodiscard]] constexpr std::size_t report_size(report::selector select) const
+    {
+        auto report_fields = fields(select);
+        return report_fields.empty() ? 0 : (report_fields.back().bit_end() / 8);
+    }
+
+    /// @brief This class parses the HID report descriptor in a single pass, validating it with
+    ///        @ref report_protocol_properties::parser, while compiling the report layout table.
+    template <typename TIterator = report_protocol_properties::descriptor_view_type::iterator,
+              std::size_t MAX_REPORT_COUNT = report_protocol_properties::max_report_count>
+    class parser : public report_protocol_properties::parser<
+                       TIterator, parser<TIterator, MAX_REPORT_COUNT>, MAX_REPORT_COUNT>
+    {
+        friend rdf::static_parser<parser<TIterator, MAX_REPORT_COUNT>, TIterator>;
+
+      public:
+        using base = report_protocol_properties::parser<
+            TIterator, parser<TIterator, MAX_REPORT_COUNT>, MAX_REPORT_COUNT>;
+        using item_type = base::item_type;
+        using items_view_type = base::items_view_type;
+        using control = base::control;
+
+        /// @brief Parses the descriptor, and stores the report fields in the provided storage.
+        /// @param desc_view: the HID report descriptor's view
+        /// @param storage: the output storage of the layout table, pass an empty span to only
+        ///        calculate the required size with @ref field_count
+        constexpr parser(const rdf::descriptor_view_base<TIterator>& desc_view,
+                         std::span<report_field> storage)
+            : base(), storage_(storage)
+        {
+            base::parse(desc_view);
+
+            if (field_count_ <= storage_.size())
+            {
+                std::ranges::sort(storage_.first(field_count_),
+                                  [](const report_field& a, const report_field& b)
+                                  {
+                                      return (selector_key(a) < selector_key(b)) or
+                                             ((a.selector == b.selector) and
+                                              (a.bit_offset < b.bit_offset));
+                                  });
+            }
+        }
+
+        constexpr ~parser() = default;
+
+        parser(const parser&) = delete;
+        parser& operator=(const parser&) = delete;
+        parser(parser&&) = delete;
+        parser& operator=(parser&&) = delete;
+
+        /// @brief The number of fields the descriptor's layout consists of.
+        [[nodiscard]] constexpr std::size_t field_count() const { return field_count_; }
+
+        /// @brief  Provides the compiled layout.
+        /// @return The layout view of the storage provided at construction
+        [[nodiscard]] constexpr report_layout layout() const
+        {
+            HID_RP_ASSERT(field_count_ <= storage_.size(), ex_report_table_invalid_size);
+            return report_layout(storage_.first(field_count_));
+        }
+
+      protected:
+        using base::get_report_data_field_params;
+
+        constexpr control parse_report_data_field(const item_type& main_item,
+                                                  const rdf::global_item_store& global_state,
+                                                  const items_view_type& main_section,
+                                                  unsigned tlc_count)
+        {
+            using namespace hid::rdf;
+
+            auto params = get_report_data_field_params(global_state);
+            auto rtype = main::tag_to_report_type(main_item.main_tag());
+            report_field field{};
+            field.selector = report::selector(rtype, params.id);
+            field.bit_offset = static_cast<std::uint16_t>(
+                ((params.id > 0) ? 8 * sizeof(report::id) : 0) + base::bit_size(rtype, params.id));
+
+            // validate the item first
+            auto ctrl = base::parse_report_data_field(main_item, global_state, main_section,
+                                                      tlc_count);
+
+            field.bit_size = static_cast<std::uint16_t>(params.size);
+            field.flags = static_cast<std::uint16_t>(main_item.value_unsigned());
+            set_limits(field, global_state);
+            add_fields(field, static_cast<std::uint16_t>(params.count), global_state,
+                       main_section);
+            return ctrl;
+        }
+
+      private:
+        constexpr void add_field(const report_field& field)
+        {
+            if (field_count_ < storage_.size())
+            {
+                storage_[field_count_] = field;
+            }
+            field_count_++;
+        }
+
+        constexpr static std::int32_t
+        get_limit_value(const rdf::global_item_store& global_state, rdf::global::tag tag,
+                        bool is_signed)
+        {
+            const auto* limit_item = global_state.get_item(tag);
+            if (limit_item == nullptr)
+            {
+                return 0;
+            }
+            return is_signed ? limit_item->value_signed()
+                             : static_cast<std::int32_t>(limit_item->value_unsigned());
+        }
+
+        constexpr static void set_limits(report_field& field,
+                                         const rdf::global_item_store& global_state)
+        {
+            using namespace hid::rdf;
+
+            // array fields' limits are interpreted as unsigned
+            field.logical_min =
+                get_limit_value(global_state, global::tag::LOGICAL_MINIMUM, field.is_variable());
+            field.logical_max =
+                get_limit_value(global_state, global::tag::LOGICAL_MAXIMUM, field.is_variable());
+            field.physical_min = get_limit_value(global_state, global::tag::PHYSICAL_MINIMUM, true);
+            field.physical_max = get_limit_value(global_state, global::tag::PHYSICAL_MAXIMUM, true);
+            // HID spec 1.11, section 6.2.2.7: undefined physical extents equal the logical ones
+            if ((field.physical_min == 0) and (field.physical_max == 0))
+            {
+                field.physical_min = field.logical_min;
+                field.physical_max = field.logical_max;
+            }
+        }
+
+        /// @brief Assigns the usages of the main section to the field's elements,
+        ///        splitting the field where the usages aren't consecutive.
+        // NOLINTNEXTLINE(readability-function-cognitive-complexity)
+        constexpr void add_fields(report_field field, std::uint16_t count,
+                                  const rdf::global_item_store& global_state,
+                                  const items_view_type& main_section)
+        {
+            using namespace hid::rdf;
+
+            usage_t range_min = nullusage;
+            usage_t range_max = nullusage;
+            usage_t pending_min = nullusage;
+            bool delimiter_open = false;
+            bool delimiter_used = false;
+            std::uint16_t index = 0;
+
+            // emits the usage range to the elements starting from index
+            auto assign_range = [&](usage_t min, usage_t max)
+            {
+                if ((min == nullusage) or (index == count) or (min > max))
+                {
+                    return;
+                }
+                auto range_count =
+                    std::min<std::size_t>(max - min + 1, static_cast<std::size_t>(count - index));
+                report_field part = field;
+                part.bit_offset = static_cast<std::uint16_t>(field.element_bit_offset(index));
+                part.count = static_cast<std::uint16_t>(range_count);
+                part.usage_min = min;
+                part.usage_max = usage_t(min + static_cast<usage_t::type>(range_count - 1));
+                add_field(part);
+                index += part.count;
+            };
+            // merges consecutive usages into a single range
+            auto add_usages = [&](usage_t min, usage_t max)
+            {
+                if (field.is_array())
+                {
+                    // array elements are not bound to usages, only the range matters
+                    range_min = (range_min == nullusage) ? min : std::min(range_min, min);
+                    range_max = std::max(range_max, max);
+                }
+                else if ((range_min != nullusage) and (range_max.page_id() == min.page_id()) and
+                         (range_max + 1 == min))
+                {
+                    range_max = max;
+                }
+                else
+                {
+                    assign_range(range_min, range_max);
+                    range_min = min;
+                    range_max = max;
+                }
+            };
+
+            for (const item_type& item : main_section)
+            {
+                if (item.type() != rdf::item_type::LOCAL)
+                {
+                    continue;
+                }
+                if (item.has_tag(tag::DELIMITER))
+                {
+                    delimiter_open = item.value_unsigned() == 1;
+                    delimiter_used = false;
+                    continue;
+                }
+                if (delimiter_open)
+                {
+                    // only the first of the alternative usages is used
+                    if (delimiter_used)
+                    {
+                        continue;
+                    }
+                    delimiter_used = item.has_tag(tag::USAGE) or item.has_tag(tag::USAGE_MAXIMUM);
+                }
+                if (item.has_tag(tag::USAGE))
+                {
+                    auto usage = base::get_usage(item, global_state);
+                    add_usages(usage, usage);
+                }
+                else if (item.has_tag(tag::USAGE_MINIMUM))
+                {
+                    pending_min = base::get_usage(item, global_state);
+                }
+                else if (item.has_tag(tag::USAGE_MAXIMUM))
+                {
+                    add_usages(pending_min, base::get_usage(item, global_state));
+                }
+            }
+
+            if (range_min == nullusage)
+            {
+                // padding or constant field without usage
+                field.count = count;
+                add_field(field);
+            }
+            else if (field.is_array())
+            {
+                field.count = count;
+                field.usage_min = range_min;
+                field.usage_max = range_max;
+                add_field(field);
+            }
+            else
+            {
+                assign_range(range_min, range_max);
+                if (index < count)
+                {
+                    // HID spec 1.11, section 6.2.2.8:
+                    // the last usage applies to the remaining elements
+                    field.bit_offset = static_cast<std::uint16_t>(field.element_bit_offset(index));
+                    field.count = static_cast<std::uint16_t>(count - index);
+                    field.usage_min = range_max;
+                    field.usage_max = range_max;
+                    add_field(field);
+                }
+            }
+        }
+
+        std::span<report_field> storage_;
+        std::size_t field_count_{};
+    };
+
+  private:
+    constexpr static std::uint16_t selector_key(const report_field& field)
+    {
+        return static_cast<std::uint16_t>(field.selector);
+    }
+
+    fields_view fields_{};
+};
+
+/// @brief  Create the report layout table of a descriptor in compile-time.
+/// @tparam Data: the descriptor array, acquired e.g. from a @ref hid::rdf::descriptor call
+/// @return a std::array<hid::report_field, N> table, which is the storage for
+///         a @ref hid::report_layout view
+template <auto Data>
+consteval auto make_report_layout_table()
+{
+    constexpr std::size_t FIELD_COUNT =
+        report_layout::parser<>(rdf::ce_descriptor_view::from_descriptor<Data>(), {})
+            .field_count();
+    std::array<report_field, FIELD_COUNT> table{};
+    report_layout::parser<> parser(rdf::ce_descriptor_view::from_descriptor<Data>(), table);
+    return table;
+}
+
+/// @brief  The report layout table of a descriptor, with static storage duration,
+///         so @ref hid::report_layout views of it can be stored in compile-time constants.
+/// @tparam Data: the descriptor array, acquired e.g. from a @ref hid::rdf::descriptor call
+template <auto Data>
+inline constexpr auto report_layout_table = make_report_layout_table<Data>();
+
+/// @brief  Looks up the location of a usage within a report of a known descriptor at compile-time,
+///         so that accessing the value doesn't require any search at runtime.
+///         The compilation fails if the usage isn't assigned to the report, or if it's ambiguous.
+/// @tparam Data: the descriptor array, acquired e.g. from a @ref hid::rdf::descriptor call
+/// @tparam TYPE: the report type
+/// @tparam REPORT_ID: the report ID, 0 if the descriptor doesn't use report IDs
+/// @tparam USAGE: the usage to look up
+/// @return The variable element of the usage as a field with a single usage and count,
+///         or the array field that can select the usage
+template <auto Data, report::type TYPE, report::id::type REPORT_ID, auto USAGE>
+consteval report_field field_of()
+{
+    constexpr report_layout layout{report_layout_table<Data>};
+    constexpr report::selector select{TYPE, REPORT_ID};
+    static_assert(layout.usage_count(select, usage_t(USAGE)) > 0,
+                  "the usage isn't assigned to the report");
+    static_assert(layout.usage_count(select, usage_t(USAGE)) == 1,
+                  "the usage is assigned to multiple elements of the report");
+    const usage_t usage{USAGE};
+    report_field field = *layout.find(select, usage);
+    if (field.is_variable())
+    {
+        field.bit_offset =
+            static_cast<std::uint16_t>(field.element_bit_offset(field.usage_index(usage)));
+        field.count = 1;
+        field.usage_min = usage;
+        field.usage_max = usage;
+    }
+    return field;
+}
+
+/// @brief  Reads the value of a variable element from a raw report, at a compile-time location.
+/// @tparam Data: the descriptor array, acquired e.g. from a @ref hid::rdf::descriptor call
+/// @tparam TYPE: the report type
+/// @tparam REPORT_ID: the report ID, 0 if the descriptor doesn't use report IDs
+/// @tparam USAGE: the usage of the element
+/// @param  data: the raw report, starting with the report ID if report IDs are used
+/// @return The element's value, sign extended if the logical minimum is negative
+template <auto Data, report::type TYPE, report::id::type REPORT_ID, auto USAGE>
+[[nodiscard]] constexpr std::int32_t get_field_value(std::span<const std::uint8_t> data)
+{
+    constexpr auto field = field_of<Data, TYPE, REPORT_ID, USAGE>();
+    static_assert(field.is_variable(), "the usage is assigned to an array field");
+    HID_RP_ASSERT(field.bit_end() <= (data.size() * 8), ex_report_invalid_size);
+    const auto value = extract_bits(data, field.bit_offset, field.bit_size);
+    return field.is_signed() ? sign_extend(value, field.bit_size)
+                             : static_cast<std::int32_t>(value);
+}
+
+/// @brief  Writes the value of a variable element of a raw report, at a compile-time location.
+/// @tparam Data: the descriptor array, acquired e.g. from a @ref hid::rdf::descriptor call
+/// @tparam TYPE: the report type
+/// @tparam REPORT_ID: the report ID, 0 if the descriptor doesn't use report IDs
+/// @tparam USAGE: the usage of the element
+/// @param  data: the raw report, starting with the report ID if report IDs are used
+/// @param  value: the value to write, truncated to the element's size
+template <auto Data, report::type TYPE, report::id::type REPORT_ID, auto USAGE>
+constexpr void set_field_value(std::span<std::uint8_t> data, std::int32_t value)
+{
+    constexpr auto field = field_of<Data, TYPE, REPORT_ID, USAGE>();
+    static_assert(field.is_variable(), "the usage is assigned to an array field");
+    HID_RP_ASSERT(field.bit_end() <= (data.size() * 8), ex_report_invalid_size);
+    insert_bits(data, field.bit_offset, field.bit_size, static_cast<std::uint32_t>(value));
+}
+
+} // namespace hid
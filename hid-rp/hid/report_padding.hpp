@@ -0,0 +1,283 @@
+// SPDX-License-Identifier: MPL-2.0
+#pragma once
+
+#include <algorithm>
+#include <span>
+#include "hid/report_protocol.hpp"
+
+namespace hid
+{
+/// @brief This class describes a report data field (main item) for the padding analysis.
+struct padding_field
+{
+    report::selector selector{};
+    std::uint16_t index{};      ///< the position of the main item among all data fields
+    std::uint16_t siblings{};   ///< fields with equal value aren't separated by collection items
+    std::uint16_t bit_offset{}; ///< offset from the start of the report, including the report ID
+    std::uint16_t bit_length{}; ///< the REPORT_SIZE * REPORT_COUNT of the main item
+    std::uint16_t flags{};      ///< the main item's @ref rdf::main::data_field_flag values
+    bool is_padding{};          ///< constant field without any usage
+
+    constexpr bool operator==(const padding_field& other) const = default;
+    constexpr bool operator!=(const padding_field& other) const = default;
+
+    [[nodiscard]] constexpr std::size_t bit_end() const { return bit_offset + bit_length; }
+    [[nodiscard]] constexpr bool is_byte_sized() const { return (bit_length % 8) == 0; }
+
+    /// @brief Buffered bytes fields must start at a byte boundary (HID spec 1.11, section 6.2.2.5).
+    [[nodiscard]] constexpr bool must_be_byte_aligned() const
+    {
+        return (flags & rdf::main::data_field_flag::BUFFERED_BYTES) != 0;
+    }
+};
+
+/// @brief The padding overhead of a single report.
+struct report_padding
+{
+    report::selector selector{};
+    std::uint16_t size{};         ///< the report size in bytes, including the report ID
+    std::uint16_t padding_bits{}; ///< the total size of the padding fields
+    std::uint16_t packed_size{};  ///< the report size in bytes with a single trailing padding
+
+    constexpr bool operator==(const report_padding& other) const = default;
+    constexpr bool operator!=(const report_padding& other) const = default;
+
+    /// @brief The number of bytes that reordering the report's fields would save.
+    [[nodiscard]] constexpr std::uint16_t overhead() const
+    {
+        return static_cast<std::uint16_t>(size - packed_size);
+    }
+};
+
+/// @brief This class parses the HID report descriptor, validating it with
+///        @ref report_protocol_properties::parser, while listing its data fields
+///        in descriptor order for the padding analysis.
+template <typename TIterator = report_protocol_properties::descriptor_view_type::iterator,
+          std::size_t MAX_REPORT_COUNT = report_protocol_properties::max_report_count>
+class padding_parser : public report_protocol_properties::parser<
+                           TIterator, padding_parser<TIterator, MAX_REPORT_COUNT>, MAX_REPORT_COUNT>
+{
+    friend rdf::static_parser<padding_parser<TIterator, MAX_REPORT_COUNT>, TIterator>;
+
+  public:
+    using base = report_protocol_properties::parser<
+        TIterator, padding_parser<TIterator, MAX_REPORT_COUNT>, MAX_REPORT_COUNT>;
+    using item_type = base::item_type;
+    using items_view_type = base::items_view_type;
+    using control = base::control;
+
+    /// @brief Parses the descriptor, and stores the data fields in the provided storage.
+    /// @param desc_view: the HID report descriptor's view
+    /// @param storage: the output storage of the fields, pass an empty span to only
+    ///        calculate the required size with @ref field_count
+    constexpr padding_parser(const rdf::descriptor_view_base<TIterator>& desc_view,
+                             std::span<padding_field> storage)
+        : base(), storage_(storage)
+    {
+        base::parse(desc_view);
+    }
+
+    constexpr ~padding_parser() = default;
+
+    padding_parser(const padding_parser&) = delete;
+    padding_parser& operator=(const padding_parser&) = delete;
+    padding_parser(padding_parser&&) = delete;
+    padding_parser& operator=(padding_parser&&) = delete;
+
+    /// @brief The number of data fields in the descriptor.
+    [[nodiscard]] constexpr std::size_t field_count() const { return field_count_; }
+
+  protected:
+    using base::get_report_data_field_params;
+
+    constexpr control parse_collection_begin(rdf::main::collection_type collection,
+                                             const rdf::global_item_store& global_state,
+                                             const items_view_type& main_section,
+                                             unsigned tlc_number)
+    {
+        siblings_++;
+        return base::parse_collection_begin(collection, global_state, main_section, tlc_number);
+    }
+
+    constexpr control parse_collection_end(const rdf::global_item_store& global_state,
+                                           const items_view_type& main_section,
+                                           unsigned tlc_number)
+    {
+        siblings_++;
+        return base::parse_collection_end(global_state, main_section, tlc_number);
+    }
+
+    constexpr control parse_report_data_field(const item_type& main_item,
+                                              const rdf::global_item_store& global_state,
+                                              const items_view_type& main_section,
+                                              unsigned tlc_count)
+    {
+        using namespace hid::rdf;
+
+        auto params = get_report_data_field_params(global_state);
+        auto rtype = main::tag_to_report_type(main_item.main_tag());
+        padding_field field{};
+        field.selector = report::selector(rtype, params.id);
+        field.index = static_cast<std::uint16_t>(field_count_);
+        field.siblings = siblings_;
+        field.bit_offset = static_cast<std::uint16_t>(
+            ((params.id > 0) ? 8 * sizeof(report::id) : 0) + base::bit_size(rtype, params.id));
+
+        // validate the item first
+        auto ctrl =
+            base::parse_report_data_field(main_item, global_state, main_section, tlc_count);
+
+        field.bit_length = static_cast<std::uint16_t>(params.size * params.count);
+        field.flags = static_cast<std::uint16_t>(main_item.value_unsigned());
+        field.is_padding = (field.flags & main::data_field_flag::CONSTANT) != 0;
+        for (const item_type& item : main_section)
+        {
+            if (item.has_tag(tag::USAGE) or item.has_tag(tag::USAGE_MINIMUM))
+            {
+                field.is_padding = false;
+            }
+        }
+        if (field_count_ < storage_.size())
+        {
+            storage_[field_count_] = field;
+        }
+        field_count_++;
+        return ctrl;
+    }
+
+  private:
+    std::span<padding_field> storage_;
+    std::size_t field_count_{};
+    std::uint16_t siblings_{};
+};
+
+/// @brief  Calculates the padding overhead of a report.
+/// @param  fields: the data fields of the descriptor, as listed by @ref padding_parser
+/// @param  select: the report selector
+/// @return The report's current size, total padding, and the size it could be packed to
+[[nodiscard]] constexpr report_padding analyze_padding(std::span<const padding_field> fields,
+                                                       report::selector select)
+{
+    report_padding result{select};
+    std::size_t bit_size = (select.id() > 0) ? 8 * sizeof(report::id) : 0;
+    std::size_t data_bits = bit_size;
+    for (const auto& field : fields)
+    {
+        if (field.selector != select)
+        {
+            continue;
+        }
+        bit_size += field.bit_length;
+        if (field.is_padding)
+        {
+            result.padding_bits =
+                static_cast<std::uint16_t>(result.padding_bits + field.bit_length);
+        }
+        else
+        {
+            data_bits += field.bit_length;
+        }
+    }
+    result.size = static_cast<std::uint16_t>(bit_size / 8);
+    result.packed_size = static_cast<std::uint16_t>((data_bits + 7) / 8);
+    return result;
+}
+
+/// @brief  Proposes a field order for a report that needs as little padding as possible,
+///         while keeping the data fields among their siblings (the collections are unchanged).
+///         Within each group of siblings the byte sized fields are placed first, keeping them
+///         byte aligned where possible, then the rest of the fields follow in their original
+///         order. The padding fields are dropped, and a single padding is appended to the end.
+///         A group can start at an unaligned offset, left by the previous group: a padding is
+///         inserted before the buffered bytes fields then, as those must be byte aligned.
+/// @param  fields: the data fields of the descriptor, as listed by @ref padding_parser
+/// @param  select: the report selector
+/// @param  proposal: the output storage for the reordered fields with their new offsets,
+///         pass an empty span to only calculate the required size
+/// @return The number of fields in the proposed order
+constexpr std::size_t propose_field_order(std::span<const padding_field> fields,
+                                          report::selector select,
+                                          std::span<padding_field> proposal)
+{
+    std::size_t count = 0;
+    std::size_t bit_offset = (select.id() > 0) ? 8 * sizeof(report::id) : 0;
+    std::uint16_t last_siblings = 0;
+    auto emit_field = [&](const padding_field& field)
+    {
+        if (count < proposal.size())
+        {
+            proposal[count] = field;
+            proposal[count].bit_offset = static_cast<std::uint16_t>(bit_offset);
+        }
+        bit_offset += field.bit_length;
+        last_siblings = field.siblings;
+        count++;
+    };
+    auto emit_alignment = [&]()
+    {
+        if ((bit_offset % 8) != 0)
+        {
+            padding_field padding{select};
+            padding.index = std::numeric_limits<std::uint16_t>::max();
+            padding.siblings = last_siblings;
+            padding.bit_length = static_cast<std::uint16_t>(8 - (bit_offset % 8));
+            padding.flags = rdf::main::data_field_flag::CONSTANT;
+            padding.is_padding = true;
+            emit_field(padding);
+        }
+    };
+    auto emit = [&](const padding_field& field)
+    {
+        if (field.must_be_byte_aligned())
+        {
+            emit_alignment();
+        }
+        emit_field(field);
+    };
+
+    for (auto first = fields.begin(); first != fields.end();)
+    {
+        if ((first->selector != select) or first->is_padding)
+        {
+            ++first;
+            continue;
+        }
+        // the group of sibling fields of this report
+        auto last = std::find_if(first, fields.end(), [first](const padding_field& field)
+                                 { return field.siblings != first->siblings; });
+        auto in_group = [select](const padding_field& field)
+        { return (field.selector == select) and !field.is_padding; };
+        for (auto it = first; it != last; ++it)
+        {
+            if (in_group(*it) and it->is_byte_sized())
+            {
+                emit(*it);
+            }
+        }
+        for (auto it = first; it != last; ++it)
+        {
+            if (in_group(*it) and !it->is_byte_sized())
+            {
+                emit(*it);
+            }
+        }
+        first = last;
+    }
+    emit_alignment();
+    return count;
+}
+
+/// @brief  Create the data fields table of a descriptor in compile-time, for the padding analysis.
+/// @tparam Data: the descriptor array, acquired e.g. from a @ref hid::rdf::descriptor call
+/// @return a std::array<hid::padding_field, N> table, listing the data fields in descriptor order
+template <auto Data>
+consteval auto make_padding_fields_table()
+{
+    constexpr std::size_t FIELD_COUNT =
+        padding_parser<>(rdf::ce_descriptor_view::from_descriptor<Data>(), {}).field_count();
+    std::array<padding_field, FIELD_COUNT> table{};
+    padding_parser<> parser(rdf::ce_descriptor_view::from_descriptor<Data>(), table);
+    return table;
+}
+
+} // namespace hid
@@ -3,7 +3,10 @@
 
 #include <algorithm>
 #include <array>
+#include <bit>
 #include <ranges>
+#include <span>
+#include <type_traits>
 #include "hid/rdf/global_items.hpp"
 #include "hid/rdf/parser.hpp"
 
@@ -108,14 +111,50 @@ struct report_protocol_properties
           report_id_present(report_ids)
     {}
 
+    /// @brief The highest number of distinct reports a descriptor can define.
+    static constexpr std::size_t max_report_count = 3 * report::id::max();
+
+    /// @brief A report table capacity that fits the descriptors of most devices, with a small
+    ///        stack footprint. It is opt-in (see @ref compact_parser): parsing a descriptor with
+    ///        more reports throws @ref rdf::ex_report_count_excess.
+    static constexpr std::size_t compact_report_count = 32;
+
     /// @brief This class parses the HID report descriptor, gathering all report size
     ///        and TLC assignment information, and verifying that the descriptor describes
     ///        a valid HID protocol.
-    template <typename TIterator = descriptor_view_type::iterator>
-    class parser : public rdf::parser<TIterator>
+    ///        The reports are stored in a dense table sorted by selector, with a bitmap marking
+    ///        the selectors present: a report's index in the table is the number of lower
+    ///        selectors present. So the storage scales with the number of reports present
+    ///        in the descriptor, and finding a report takes no search.
+    /// @tparam TIterator: iterator type of the descriptor view
+    /// @tparam TDerived: the subclass that extends the item handlers (by hiding them),
+    ///         or void when this class is used on its own
+    /// @tparam MAX_REPORT_COUNT: the capacity of the report table, lower it to reduce the
+    ///         stack usage at runtime, when the number of reports is known to be limited
+    ///         (see @ref compact_report_count)
+    template <typename TIterator = descriptor_view_type::iterator, typename TDerived = void,
+              std::size_t MAX_REPORT_COUNT = max_report_count>
+    class parser
+        : public rdf::static_parser<
+              std::conditional_t<std::is_void_v<TDerived>,
+                                 parser<TIterator, TDerived, MAX_REPORT_COUNT>, TDerived>,
+              TIterator>
     {
+        using derived_type =
+            std::conditional_t<std::is_void_v<TDerived>,
+                               parser<TIterator, TDerived, MAX_REPORT_COUNT>, TDerived>;
+        friend rdf::static_parser<derived_type, TIterator>;
+        static_assert(MAX_REPORT_COUNT > 0);
+
+        struct report_entry
+        {
+            report::selector selector{};
+            size_type bit_size{};
+            std::uint16_t tlc_index{};
+        };
+
       public:
-        using base = rdf::parser<TIterator>;
+        using base = rdf::static_parser<derived_type, TIterator>;
         using item_type = base::item_type;
         using items_view_type = base::items_view_type;
         using control = base::control;
@@ -123,20 +162,10 @@ struct report_protocol_properties
         constexpr parser(const rdf::descriptor_view_base<TIterator>& desc_view)
             : base()
         {
-            base::parse_items(desc_view);
-
-            // when finished, run a final check that each report has byte size
-            for (const auto& sizes : report_bit_sizes_)
-            {
-                for (const auto& size : sizes)
-                {
-                    HID_RP_ASSERT(size % 8 == 0, ex_report_total_size_invalid);
-                }
-            }
+            parse(desc_view);
         }
 
-        // https://stackoverflow.com/questions/72835571/constexpr-c-error-destructor-used-before-its-definition
-        constexpr ~parser() override = default;
+        constexpr ~parser() = default;
 
         parser(const parser&) = delete;
         parser& operator=(const parser&) = delete;
@@ -149,9 +178,14 @@ struct report_protocol_properties
             {
                 return bit_size(type, 0) / 8;
             }
-            auto& report_sizes = bit_sizes_by_type(type);
-            auto begin = report_sizes.begin();
-            size_type max_size = *std::max_element(++begin, report_sizes.end()) / 8;
+            size_type max_size = 0;
+            for (const auto& entry : reports_of_type(type))
+            {
+                if (entry.selector.id() > 0)
+                {
+                    max_size = std::max<size_type>(max_size, entry.bit_size / 8);
+                }
+            }
             return (max_size > 0) ? sizeof(report::id) + max_size : 0;
         }
 
@@ -166,22 +200,18 @@ struct report_protocol_properties
 
         [[nodiscard]] constexpr report::id::type max_report_id(report::type type) const
         {
-            const auto& sizes = report_bit_sizes_[static_cast<std::size_t>(type) - 1];
-            auto rit = std::ranges::find_if(std::views::reverse(sizes),
-                                            [](size_type x) { return x != 0; });
-            return rit == sizes.rend() ? 0 : std::distance(rit, sizes.rend()) - 1;
+            auto type_reports = reports_of_type(type);
+            return type_reports.empty() ? report::id::type{0}
+                                        : report::id::type{type_reports.back().selector.id()};
         }
 
         [[nodiscard]] constexpr size_type report_count() const
         {
-            return static_cast<size_type>(std::ranges::count_if(std::views::join(report_bit_sizes_),
-                                                                [](auto v) { return v > 0; }));
+            return static_cast<size_type>(report_count_);
         }
         [[nodiscard]] constexpr report::id::type report_count(report::type type) const
         {
-            const auto& sizes = report_bit_sizes_[static_cast<std::size_t>(type) - 1];
-            return static_cast<report::id::type>(
-                std::ranges::count_if(sizes, [](auto size) { return size > 0; }));
+            return static_cast<report::id::type>(reports_of_type(type).size());
         }
 
         template <std::size_t N>
@@ -189,26 +219,19 @@ struct report_protocol_properties
         {
             HID_RP_ASSERT(table.size() == report_count(), ex_report_table_invalid_size);
             auto table_it = table.begin();
-            for (std::size_t type = 0; type < report_bit_sizes_.size(); ++type)
+            for (const auto& entry : reports())
             {
-                for (std::size_t id = 0; id < report_bit_sizes_.front().size(); ++id)
-                {
-                    if (report_bit_sizes_[type][id] > 0)
-                    {
-                        std::size_t byte_size =
-                            (id != 0) * sizeof(report::id) + report_bit_sizes_[type][id] / 8;
-                        HID_RP_ASSERT(byte_size <= std::numeric_limits<std::uint16_t>::max(),
-                                      ex_report_invalid_size);
-                        *table_it = report::properties{
-                            report::selector(static_cast<report::type>(type + 1), id),
-                            static_cast<std::uint16_t>(byte_size)};
-                        ++table_it;
-                    }
-                }
+                std::size_t byte_size =
+                    (entry.selector.id() != 0) * sizeof(report::id) + entry.bit_size / 8;
+                HID_RP_ASSERT(byte_size <= std::numeric_limits<std::uint16_t>::max(),
+                              ex_report_invalid_size);
+                *table_it =
+                    report::properties{entry.selector, static_cast<std::uint16_t>(byte_size)};
+                ++table_it;
             }
         }
 
-      private:
+      protected:
         using base::check_delimiters;
         using base::get_logical_limits_signed;
         using base::get_logical_limits_unsigned;
@@ -216,11 +239,30 @@ struct report_protocol_properties
         using base::get_report_data_field_params;
         using base::parse_items;
 
+        /// @brief Constructs the parser without parsing, subclasses that extend the parsing logic
+        ///        need to call @ref parse from their own constructor.
+        constexpr parser()
+            : base()
+        {}
+
+        /// @brief Parses the descriptor, then verifies that each report has byte size.
+        /// @param desc_view: the HID report descriptor's view
+        constexpr void parse(const rdf::descriptor_view_base<TIterator>& desc_view)
+        {
+            base::parse_items(desc_view);
+
+            // when finished, run a final check that each report has byte size
+            for (const auto& entry : reports())
+            {
+                HID_RP_ASSERT(entry.bit_size % 8 == 0, ex_report_total_size_invalid);
+            }
+        }
+
         constexpr control
         parse_collection_begin([[maybe_unused]] rdf::main::collection_type collection,
                                [[maybe_unused]] const rdf::global_item_store& global_state,
                                const items_view_type& main_section,
-                               [[maybe_unused]] unsigned tlc_number) override
+                               [[maybe_unused]] unsigned tlc_number)
         {
             // only for descriptor verification purpose
             HID_RP_ASSERT(!check_delimiters(main_section) or
@@ -232,7 +274,7 @@ struct report_protocol_properties
         constexpr control
         parse_collection_end([[maybe_unused]] const rdf::global_item_store& global_state,
                              const items_view_type& main_section,
-                             [[maybe_unused]] unsigned tlc_number) override
+                             [[maybe_unused]] unsigned tlc_number)
         {
             // only for descriptor verification purpose
             HID_RP_ASSERT(!check_delimiters(main_section), ex_delimiter_invalid_location);
@@ -242,7 +284,7 @@ struct report_protocol_properties
         // NOLINTNEXTLINE(readability-function-cognitive-complexity)
         constexpr control parse_report_data_field(
             const item_type& main_item, const rdf::global_item_store& global_state,
-            [[maybe_unused]] const items_view_type& main_section, unsigned tlc_count) override
+            [[maybe_unused]] const items_view_type& main_section, unsigned tlc_count)
         {
             using namespace hid::rdf;
             report::type rtype = main::tag_to_report_type(main_item.main_tag());
@@ -251,33 +293,34 @@ struct report_protocol_properties
             if (report_params.id)
             {
                 // check that there is no report field with missing ID
-                HID_RP_ASSERT(std::find_if(report_bit_sizes_.begin(), report_bit_sizes_.end(),
-                                           [](auto sizes)
-                                           { return sizes[0] > 0; }) == report_bit_sizes_.end(),
-                              ex_report_id_missing);
+                HID_RP_ASSERT(!report_without_id_, ex_report_id_missing);
             }
 
+            auto& entry = find_or_add_report(report::selector(rtype, report_params.id));
+            report_without_id_ = report_without_id_ or (report_params.id == 0);
             if (main_item.value_unsigned() & main::data_field_flag::BUFFERED_BYTES)
             {
-                HID_RP_ASSERT((report_params.size % 8 == 0) and
-                                  (bit_size(rtype, report_params.id) % 8 == 0),
+                HID_RP_ASSERT((report_params.size % 8 == 0) and (entry.bit_size % 8 == 0),
                               ex_buffered_bytes_misaligned, main_item.main_tag());
             }
 
             // increase size of this report
-            bit_size(rtype, report_params.id) += report_params.size * report_params.count;
+            auto new_bit_size = entry.bit_size + (report_params.size * report_params.count);
+            HID_RP_ASSERT(new_bit_size <= std::numeric_limits<size_type>::max(),
+                          ex_report_invalid_size);
+            entry.bit_size = static_cast<size_type>(new_bit_size);
 
             // the following are only compile-time checks:
             // verify that the report doesn't cross TLC boundary
-            auto& report_tlc_index = tlc_index(rtype, report_params.id);
-            if (report_tlc_index == 0)
+            if (entry.tlc_index == 0)
             {
                 // first piece of the report, assign to TLC now
-                report_tlc_index = tlc_count;
+                entry.tlc_index = static_cast<std::uint16_t>(tlc_count);
             }
             else
             {
-                HID_RP_ASSERT(report_tlc_index == tlc_count, ex_report_crossing_tlc_bounds);
+                HID_RP_ASSERT(entry.tlc_index == static_cast<std::uint16_t>(tlc_count),
+                              ex_report_crossing_tlc_bounds);
             }
 
             HID_RP_ASSERT(!check_delimiters(main_section) or
@@ -367,53 +410,116 @@ struct report_protocol_properties
             return control::CONTINUE;
         }
 
-        // NOLINTBEGIN(cppcoreguidelines-pro-bounds-constant-array-index)
-        [[nodiscard]] constexpr size_type& bit_size(report::type rt, report::id::type id)
+        /// @brief  Gets the current bit size of a report.
+        /// @return The bit size of the report, 0 if the report isn't present (yet)
+        [[nodiscard]] constexpr size_type bit_size(report::type rt, report::id::type id) const
         {
-            return bit_sizes_by_type(rt)[id];
+            auto index = report_index(report::selector(rt, id));
+            return (index < report_count_) ? reports_[index].bit_size : size_type{0};
         }
-        [[nodiscard]] constexpr const size_type& bit_size(report::type rt,
-                                                          report::id::type id) const
+
+      private:
+        static constexpr std::uint16_t selector_key(const report_entry& entry)
         {
-            return bit_sizes_by_type(rt)[id];
+            return static_cast<std::uint16_t>(entry.selector);
         }
-        [[nodiscard]] constexpr std::array<size_type, report::id::max()>&
-        bit_sizes_by_type(report::type rt)
+
+        [[nodiscard]] constexpr std::span<const report_entry> reports() const
         {
-            return report_bit_sizes_[static_cast<report::id::type>(rt) - 1];
+            return std::span<const report_entry>(reports_.data(), report_count_);
         }
-        [[nodiscard]] constexpr const std::array<size_type, report::id::max()>&
-        bit_sizes_by_type(report::type rt) const
+
+        [[nodiscard]] constexpr std::span<const report_entry> reports_of_type(report::type rt) const
         {
-            return report_bit_sizes_[static_cast<report::id::type>(rt) - 1];
+            auto first = std::ranges::lower_bound(
+                reports(), static_cast<std::uint16_t>(report::selector(rt, 0)), {}, selector_key);
+            auto last = std::ranges::find_if(first, reports().end(),
+                                             [rt](const report_entry& entry)
+                                             { return entry.selector.type() != rt; });
+            return {first, last};
         }
 
-        [[nodiscard]] constexpr unsigned& tlc_index(report::type rt, report::id::type id)
+        /// @brief The bit position of a selector in the presence bitmap.
+        static constexpr std::size_t presence_bit(report::selector select)
         {
-            return tlc_indexes_by_type(rt)[id];
+            return ((static_cast<std::size_t>(select.type()) - 1) << 8) | select.id();
         }
-        [[nodiscard]] constexpr const unsigned& tlc_index(report::type rt,
-                                                          report::id::type id) const
+
+        [[nodiscard]] constexpr bool is_present(report::selector select) const
         {
-            return tlc_indexes_by_type(rt)[id];
+            auto bit = presence_bit(select);
+            return (bit < (present_.size() * 32)) and ((present_[bit / 32] >> (bit % 32)) & 1U);
         }
-        [[nodiscard]] constexpr std::array<unsigned, report::id::max()>&
-        tlc_indexes_by_type(report::type rt)
+
+        /// @brief  Finds the report in the table.
+        /// @return The index of the report, or the report count if it isn't present
+        [[nodiscard]] constexpr std::size_t report_index(report::selector select) const
         {
-            return report_tlc_indexes_[static_cast<report::id::type>(rt) - 1];
+            if (!is_present(select))
+            {
+                return report_count_;
+            }
+            // consecutive data fields mostly belong to the same report
+            if (reports_[last_index_].selector == select)
+            {
+                return last_index_;
+            }
+            return presence_rank(presence_bit(select));
         }
-        [[nodiscard]] constexpr const std::array<unsigned, report::id::max()>&
-        tlc_indexes_by_type(report::type rt) const
+
+        /// @brief  Counts the selectors present below a bitmap position, which is the index of
+        ///         the selector in the table.
+        [[nodiscard]] constexpr std::size_t presence_rank(std::size_t bit) const
+        {
+            std::size_t rank = 0;
+            for (std::size_t word = 0; word < (bit / 32); ++word)
+            {
+                rank += static_cast<std::size_t>(std::popcount(present_[word]));
+            }
+            return rank + static_cast<std::size_t>(
+                              std::popcount(present_[bit / 32] & ((1U << (bit % 32)) - 1U)));
+        }
+
+        /// @brief  Finds the report in the table, or inserts it at its rank when it's new.
+        constexpr report_entry& find_or_add_report(report::selector select)
         {
-            return report_tlc_indexes_[static_cast<report::id::type>(rt) - 1];
+            if (!is_present(select))
+            {
+                HID_RP_ASSERT(report_count_ < reports_.size(), ex_report_count_excess);
+                auto bit = presence_bit(select);
+                auto index = presence_rank(bit);
+                present_[bit / 32] |= 1U << (bit % 32);
+                std::ranges::move_backward(reports_.begin() + index,
+                                           reports_.begin() + report_count_,
+                                           reports_.begin() + report_count_ + 1);
+                reports_[index] = report_entry{select};
+                report_count_++;
+                last_index_ = index;
+                return reports_[index];
+            }
+            auto index = report_index(select);
+            last_index_ = index;
+            return reports_[index];
         }
-        // NOLINTEND(cppcoreguidelines-pro-bounds-constant-array-index)
 
-        std::array<std::array<size_type, report::id::max()>, 3> report_bit_sizes_{};
-        std::array<std::array<unsigned, report::id::max()>, 3> report_tlc_indexes_{};
+        std::array<report_entry, MAX_REPORT_COUNT> reports_{};
+        std::array<std::uint32_t, (3 * 256) / 32> present_{}; // bitmap of the selectors present
+        std::size_t report_count_{};
+        std::size_t last_index_{};
+        bool report_without_id_{};
     };
 
-    consteval explicit report_protocol_properties(const parser<>& parsed)
+    /// @brief The @ref parser with the @ref compact_report_count capacity, for runtime parsing
+    ///        with a small stack footprint, when the descriptor is known to define few reports.
+    template <typename TIterator = descriptor_view_type::iterator, typename TDerived = void>
+    using compact_parser = parser<TIterator, TDerived, compact_report_count>;
+
+    /// @brief Define the report protocol properties from the results of a descriptor parser,
+    ///        at compile-time or runtime.
+    /// @param parsed: the parser that has processed the HID report descriptor
+    template <typename TIterator, typename TDerived, std::size_t MAX_REPORT_COUNT>
+    constexpr explicit report_protocol_properties(
+        const parser<TIterator, TDerived, MAX_REPORT_COUNT>& parsed)
         : report_protocol_properties(
               parsed.max_report_size(report::type::INPUT),
               parsed.max_report_size(report::type::OUTPUT),
@@ -425,10 +531,30 @@ struct report_protocol_properties
     /// @brief Define the report protocol properties by parsing the descriptor in compile-time.
     /// @param desc_view: View of the HID report descriptor
     consteval explicit report_protocol_properties(const descriptor_view_type& desc_view)
-        : report_protocol_properties(parser<>(desc_view))
+        : report_protocol_properties(
+              parser<descriptor_view_type::iterator, void, max_report_count>(desc_view))
     {}
 };
 
+/// @brief  Parses the HID report descriptor at runtime (e.g. on the host, when the descriptor is
+///         read from the device), and gathers its report protocol properties, without heap
+///         allocation. The descriptor is verified the same way as at compile-time.
+/// @tparam MAX_REPORT_COUNT: the max number of reports the descriptor may define,
+///         it determines the stack usage of the parsing
+/// @param  desc_view: View of the HID report descriptor
+/// @return the report protocol properties of the descriptor
+/// @throws if errors are encountered during parsing, a @ref rdf::parser_exception is raised,
+///         @ref rdf::ex_report_count_excess when the descriptor has more than MAX_REPORT_COUNT
+///         reports
+template <std::size_t MAX_REPORT_COUNT = report_protocol_properties::max_report_count,
+          typename TIterator>
+constexpr report_protocol_properties
+get_report_protocol_properties(const rdf::descriptor_view_base<TIterator>& desc_view)
+{
+    return report_protocol_properties(
+        report_protocol_properties::parser<TIterator, void, MAX_REPORT_COUNT>(desc_view));
+}
+
 /// @brief This class holds the necessary information about the specific HID report protocol
 ///        that the device implements. This information is used by the transport layer
 ///        to establish a proper size data channel between the host and the device.
@@ -471,7 +597,9 @@ struct report_protocol : public report_protocol_properties
 template <auto Data>
 consteval auto make_report_properties_table()
 {
-    constexpr report_protocol::parser<> parser{rdf::ce_descriptor_view::from_descriptor<Data>()};
+    constexpr report_protocol::parser<rdf::ce_descriptor_view::iterator, void,
+                                      report_protocol::max_report_count>
+        parser{rdf::ce_descriptor_view::from_descriptor<Data>()};
     std::array<report::properties, parser.report_count()> table;
     parser.fill_report_properties_table(table);
     return table;
@@ -0,0 +1,258 @@
+// SPDX-License-Identifier: MPL-2.0
+#pragma once
+
+#include <algorithm>
+#include <span>
+#include <utility>
+#include "hid/report_protocol.hpp"
+
+namespace hid
+{
+/// @brief This class describes which top-level collection a report belongs to.
+struct report_route
+{
+    report::selector selector{};
+    std::uint16_t tlc_index{};      ///< the top-level collection's index, starting from 0
+    usage_t application{nullusage}; ///< the usage of the top-level collection
+    std::uint16_t size{};           ///< the report size in bytes, including the report ID
+
+    constexpr bool operator==(const report_route& other) const = default;
+    constexpr bool operator!=(const report_route& other) const = default;
+};
+
+/// @brief This class is a view of a report routing table: a flat table of @ref report_route
+///        elements, sorted by report selector. It allows dispatching reports to the handler
+///        (or endpoint) of their top-level collection with a single lookup.
+class report_routing
+{
+  public:
+    using routes_view = std::span<const report_route>;
+    using iterator = routes_view::iterator;
+
+    constexpr report_routing() = default;
+    constexpr explicit report_routing(routes_view routes)
+        : routes_(routes)
+    {}
+
+    [[nodiscard]] constexpr routes_view routes() const { return routes_; }
+    [[nodiscard]] constexpr iterator begin() const { return routes_.begin(); }
+    [[nodiscard]] constexpr iterator end() const { return routes_.end(); }
+    [[nodiscard]] constexpr std::size_t size() const { return routes_.size(); }
+    [[nodiscard]] constexpr bool empty() const { return routes_.empty(); }
+
+    /// @brief  Finds the route of a report.
+    /// @param  select: the report selector
+    /// @return Pointer to the report's route, or nullptr if the report isn't defined
+    [[nodiscard]] constexpr const report_route* find(report::selector select) const
+    {
+        auto it = std::ranges::lower_bound(routes_, static_cast<std::uint16_t>(select), {},
+                                           selector_key);
+        return ((it != routes_.end()) and (it->selector == select)) ? &(*it) : nullptr;
+    }
+
+    /// @brief The number of top-level collections that define reports.
+    [[nodiscard]] constexpr std::size_t tlc_count() const
+    {
+        std::size_t count = 0;
+        for (const auto& route : routes_)
+        {
+            count = std::max<std::size_t>(count, route.tlc_index + 1U);
+        }
+        return count;
+    }
+
+    /// @brief  Gathers the report protocol properties of a single top-level collection,
+    ///         so the buffers of its own endpoint (or device) can be sized exactly.
+    /// @param  tlc_index: the top-level collection's index, starting from 0
+    /// @return The maximum report sizes (including the report ID) and report counts of the
+    ///         reports that belong to the top-level collection
+    [[nodiscard]] constexpr report_protocol_properties tlc_properties(std::size_t tlc_index) const
+    {
+        using size_type = report_protocol_properties::size_type;
+        std::array<size_type, 3> max_sizes{};
+        std::array<report::id::type, 3> counts{};
+        bool report_ids = false;
+        for (const auto& route : routes_)
+        {
+            if (route.tlc_index != tlc_index)
+            {
+                continue;
+            }
+            auto type_index = static_cast<std::size_t>(route.selector.type()) - 1;
+            max_sizes[type_index] = std::max<size_type>(max_sizes[type_index], route.size);
+            counts[type_index]++;
+            report_ids = report_ids or (route.selector.id() > 0);
+        }
+        return report_protocol_properties(max_sizes[0], max_sizes[1], max_sizes[2], counts[0],
+                                          counts[1], counts[2], report_ids);
+    }
+
+    /// @brief This class parses the HID report descriptor, validating it with
+    ///        @ref report_protocol_properties::parser, while compiling the report routing table.
+    template <typename TIterator = report_protocol_properties::descriptor_view_type::iterator,
+              std::size_t MAX_REPORT_COUNT = report_protocol_properties::max_report_count>
+    class parser : public report_protocol_properties::parser<
+                       TIterator, parser<TIterator, MAX_REPORT_COUNT>, MAX_REPORT_COUNT>
+    {
+        friend rdf::static_parser<parser<TIterator, MAX_REPORT_COUNT>, TIterator>;
+
+      public:
+        using base = report_protocol_properties::parser<
+            TIterator, parser<TIterator, MAX_REPORT_COUNT>, MAX_REPORT_COUNT>;
+        using item_type = base::item_type;
+        using items_view_type = base::items_view_type;
+        using control = base::control;
+
+        /// @brief Parses the descriptor, and stores the report routes in the provided storage.
+        /// @param desc_view: the HID report descriptor's view
+        /// @param storage: the output storage of the routing table, pass an empty span to only
+        ///        calculate the required size with @ref route_count
+        constexpr parser(const rdf::descriptor_view_base<TIterator>& desc_view,
+                         std::span<report_route> storage)
+            : base(), storage_(storage)
+        {
+            base::parse(desc_view);
+
+            // the report sizes are final after the whole descriptor is parsed
+            for (auto& route : storage_.first(std::min(route_count_, storage_.size())))
+            {
+                route.size = static_cast<std::uint16_t>(
+                    ((route.selector.id() > 0) ? sizeof(report::id) : 0) +
+                    (base::bit_size(route.selector.type(), route.selector.id()) / 8));
+            }
+        }
+
+        constexpr ~parser() = default;
+
+        parser(const parser&) = delete;
+        parser& operator=(const parser&) = delete;
+        parser(parser&&) = delete;
+        parser& operator=(parser&&) = delete;
+
+        /// @brief The number of reports the descriptor defines.
+        [[nodiscard]] constexpr std::size_t route_count() const { return base::report_count(); }
+
+        /// @brief  Provides the compiled routing table.
+        /// @return The routing view of the storage provided at construction
+        [[nodiscard]] constexpr report_routing routing() const
+        {
+            HID_RP_ASSERT(route_count() <= storage_.size(), ex_report_table_invalid_size);
+            return report_routing(storage_.first(route_count()));
+        }
+
+      protected:
+        using base::get_report_data_field_params;
+
+        constexpr control parse_collection_begin(rdf::main::collection_type collection,
+                                                 const rdf::global_item_store& global_state,
+                                                 const items_view_type& main_section,
+                                                 unsigned tlc_number)
+        {
+            auto ctrl =
+                base::parse_collection_begin(collection, global_state, main_section, tlc_number);
+            if (tlc_number != tlc_number_)
+            {
+                // the first collection of the top-level collection is the application
+                tlc_number_ = tlc_number;
+                application_ = nullusage;
+                for (const item_type& item : main_section)
+                {
+                    if (item.has_tag(rdf::tag::USAGE))
+                    {
+                        application_ = base::get_usage(item, global_state);
+                        break;
+                    }
+                }
+            }
+            return ctrl;
+        }
+
+        constexpr control parse_report_data_field(const item_type& main_item,
+                                                  const rdf::global_item_store& global_state,
+                                                  const items_view_type& main_section,
+                                                  unsigned tlc_count)
+        {
+            using namespace hid::rdf;
+
+            // validate the item first
+            auto ctrl = base::parse_report_data_field(main_item, global_state, main_section,
+                                                      tlc_count);
+            if (storage_.empty())
+            {
+                return ctrl;
+            }
+
+            auto params = get_report_data_field_params(global_state);
+            auto select =
+                report::selector(main::tag_to_report_type(main_item.main_tag()), params.id);
+            auto routes = storage_.first(std::min(route_count_, storage_.size()));
+            auto it = std::ranges::lower_bound(routes, static_cast<std::uint16_t>(select), {},
+                                               selector_key);
+            if ((it == routes.end()) or (it->selector != select))
+            {
+                // insert the new report in order, when the storage fits it
+                if (route_count_ < storage_.size())
+                {
+                    std::ranges::move_backward(it, routes.end(), routes.end() + 1);
+                    *it = report_route{select, static_cast<std::uint16_t>(tlc_count - 1),
+                                       application_};
+                }
+                route_count_++;
+            }
+            return ctrl;
+        }
+
+      private:
+        std::span<report_route> storage_;
+        std::size_t route_count_{};
+        unsigned tlc_number_{};
+        usage_t application_{nullusage};
+    };
+
+  private:
+    constexpr static std::uint16_t selector_key(const report_route& route)
+    {
+        return static_cast<std::uint16_t>(route.selector);
+    }
+
+    routes_view routes_{};
+};
+
+/// @brief  Create the report routing table of a descriptor in compile-time.
+/// @tparam Data: the descriptor array, acquired e.g. from a @ref hid::rdf::descriptor call
+/// @return a std::array<hid::report_route, N> table, which is the storage for
+///         a @ref hid::report_routing view
+template <auto Data>
+consteval auto make_report_routing_table()
+{
+    constexpr std::size_t ROUTE_COUNT =
+        report_routing::parser<>(rdf::ce_descriptor_view::from_descriptor<Data>(), {})
+            .route_count();
+    std::array<report_route, ROUTE_COUNT> table{};
+    report_routing::parser<> parser(rdf::ce_descriptor_view::from_descriptor<Data>(), table);
+    return table;
+}
+
+/// @brief  The report routing table of a descriptor, with static storage duration,
+///         so @ref hid::report_routing views of it can be stored in compile-time constants.
+/// @tparam Data: the descriptor array, acquired e.g. from a @ref hid::rdf::descriptor call
+template <auto Data>
+inline constexpr auto report_routing_table = make_report_routing_table<Data>();
+
+/// @brief  Create a table of the report protocol properties of each top-level collection
+///         in compile-time, for sizing the buffers of each collection's endpoint.
+/// @tparam Data: the descriptor array, acquired e.g. from a @ref hid::rdf::descriptor call
+/// @return a std::array<hid::report_protocol_properties, N> table, indexed by the
+///         top-level collection's index
+template <auto Data>
+consteval auto make_tlc_properties_table()
+{
+    constexpr report_routing routing{report_routing_table<Data>};
+    return []<std::size_t... I>(std::index_sequence<I...>)
+    {
+        return std::array<report_protocol_properties, sizeof...(I)>{
+            report_routing(report_routing_table<Data>).tlc_properties(I)...};
+    }(std::make_index_sequence<routing.tlc_count()>());
+}
+
+} // namespace hid
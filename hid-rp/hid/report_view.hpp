@@ -0,0 +1,192 @@
+// SPDX-License-Identifier: MPL-2.0
+#pragma once
+
+#include <optional>
+#include <type_traits>
+#include "hid/report_dispatch_table.hpp"
+
+namespace hid
+{
+/// @brief This class is a non-owning view of a raw report buffer, which accesses the report's
+///        values by their usages, through the report's compiled layout.
+///        No parsing or allocation happens at access time.
+/// @tparam TByte: the byte type of the buffer, const for read-only access
+template <typename TByte>
+class basic_report_view
+{
+  public:
+    using span_type = std::span<TByte>;
+
+    constexpr basic_report_view() = default;
+
+    /// @brief Creates a view of a report buffer.
+    /// @param fields: the report's fields, acquired from @ref report_layout::fields(selector)
+    ///        or @ref report_dispatch_table::fields
+    /// @param data: the raw report, starting with the report ID if report IDs are used,
+    ///        it must contain all bytes spanned by the fields
+    constexpr basic_report_view(report_layout::fields_view fields, span_type data)
+        : fields_(fields), data_(data)
+    {
+        HID_RP_ASSERT(fields_.empty() or (fields_.back().bit_end() <= (data_.size() * 8)),
+                      ex_report_invalid_size);
+    }
+
+    /// @brief Creates a view of a received report, when the report's selector is unknown.
+    ///        The view is empty if the report isn't valid for the dispatch table.
+    /// @param table: the dispatch table of the report descriptor
+    /// @param type: the report's type
+    /// @param data: the raw report, starting with the report ID if report IDs are used
+    constexpr basic_report_view(const report_dispatch_table& table, report::type type,
+                                span_type data)
+        : fields_(table.fields(type, data)), data_(fields_.empty() ? span_type() : data)
+    {}
+
+    [[nodiscard]] constexpr bool empty() const { return fields_.empty(); }
+    [[nodiscard]] constexpr report_layout::fields_view fields() const { return fields_; }
+    [[nodiscard]] constexpr span_type data() const { return data_; }
+    [[nodiscard]] constexpr report::selector selector() const
+    {
+        return fields_.empty() ? report::selector() : fields_.front().selector;
+    }
+
+    /// @brief  Finds the field that the usage is assigned to.
+    /// @param  usage: the usage to look for
+    /// @return Pointer to the field, or nullptr if the report has no such field
+    [[nodiscard]] constexpr const report_field* find(usage_t usage) const
+    {
+        auto it = std::ranges::find_if(fields_, [usage](const report_field& field)
+                                       { return field.has_usage(usage); });
+        return (it != fields_.end()) ? &*it : nullptr;
+    }
+
+    /// @brief  Reads the value of a variable field's element.
+    /// @param  usage: the usage of the element
+    /// @return The element's value (sign extended if the logical minimum is negative),
+    ///         or nothing if the usage isn't assigned to a variable field
+    [[nodiscard]] constexpr std::optional<std::int32_t> get(usage_t usage) const
+    {
+        const auto* field = find(usage);
+        if ((field == nullptr) or !field->is_variable())
+        {
+            return std::nullopt;
+        }
+        auto value = extract_bits(bytes(), field->element_bit_offset(field->usage_index(usage)),
+                                  field->bit_size);
+        return field->is_signed() ? sign_extend(value, field->bit_size)
+                                  : static_cast<std::int32_t>(value);
+    }
+
+    /// @brief  Reads all element values of the field that the usage is assigned to.
+    /// @param  usage: any usage of the field (for array fields any usage of the selectable range)
+    /// @param  values: the output buffer, it must fit all elements of the field
+    /// @return The number of read values, zero if the usage isn't assigned to any field
+    constexpr std::size_t get_array(usage_t usage, std::span<std::int32_t> values) const
+    {
+        const auto* field = find(usage);
+        if (field == nullptr)
+        {
+            return 0;
+        }
+        extract(bytes(), field->elements(), values);
+        return field->count;
+    }
+
+    /// @brief Calls a function with each active usage of the report: the set bits of
+    ///        1-bit variable fields (such as buttons), and the selected usages of array fields.
+    /// @param func: the function to call with each active usage
+    template <typename TFunc>
+    constexpr void for_each_active_usage(TFunc&& func) const
+    {
+        for (const auto& field : fields_)
+        {
+            if (field.is_padding())
+            {
+                continue;
+            }
+            if (field.is_array())
+            {
+                for (std::size_t i = 0; i < field.count; ++i)
+                {
+                    auto value = extract_bits(bytes(), field.element_bit_offset(i), field.bit_size);
+                    auto index = (field.is_signed() ? sign_extend(value, field.bit_size)
+                                                    : static_cast<std::int32_t>(value)) -
+                                 field.logical_min;
+                    // out of range values and the reserved usage ID 0 mean no selection
+                    if ((index < 0) or
+                        (static_cast<usage_t::type>(index) > (field.usage_max - field.usage_min)))
+                    {
+                        continue;
+                    }
+                    auto usage = usage_t(field.usage_min + static_cast<usage_t::type>(index));
+                    if (usage.id() != 0)
+                    {
+                        func(usage);
+                    }
+                }
+            }
+            else if (field.bit_size == 1)
+            {
+                for_each_set_bit(bytes(), field.bit_offset, field.count,
+                                 [&](std::size_t index) { func(field.usage(index)); });
+            }
+        }
+    }
+
+    /// @brief  Writes the value of a variable field's element.
+    /// @param  usage: the usage of the element
+    /// @param  value: the value to write, truncated to the field size
+    /// @return true if the usage is assigned to a variable field, false otherwise
+    constexpr bool set(usage_t usage, std::int32_t value) const
+        requires(!std::is_const_v<TByte>)
+    {
+        const auto* field = find(usage);
+        if ((field == nullptr) or !field->is_variable())
+        {
+            return false;
+        }
+        insert_bits(data_, field->element_bit_offset(field->usage_index(usage)), field->bit_size,
+                    static_cast<std::uint32_t>(value));
+        return true;
+    }
+
+    /// @brief  Writes all element values of the field that the usage is assigned to.
+    /// @param  usage: any usage of the field (for array fields any usage of the selectable range)
+    /// @param  values: the values to write, it must contain all elements of the field
+    /// @return true if the usage is assigned to a field, false otherwise
+    constexpr bool set_array(usage_t usage, std::span<const std::int32_t> values) const
+        requires(!std::is_const_v<TByte>)
+    {
+        const auto* field = find(usage);
+        if (field == nullptr)
+        {
+            return false;
+        }
+        insert(data_, field->elements(), values);
+        return true;
+    }
+
+    /// @brief Clears the report's data, and sets its report ID (if used).
+    constexpr void clear() const
+        requires(!std::is_const_v<TByte>)
+    {
+        std::ranges::fill(data_, 0);
+        if (!data_.empty())
+        {
+            data_.front() = selector().id();
+        }
+    }
+
+  private:
+    [[nodiscard]] constexpr std::span<const std::uint8_t> bytes() const { return data_; }
+
+    report_layout::fields_view fields_{};
+    span_type data_{};
+};
+
+/// @brief Read-only view of a received report.
+using report_view = basic_report_view<const std::uint8_t>;
+
+/// @brief Writable view of a report buffer, for composing OUTPUT and FEATURE reports in place.
+using mutable_report_view = basic_report_view<std::uint8_t>;
+
+} // namespace hid
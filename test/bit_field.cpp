@@ -0,0 +1,105 @@
+#include <array>
+#include <vector>
+#include "hid/app/mouse.hpp"
+#include "hid/bit_field.hpp"
+#include "test_framework.hpp"
+
+using namespace hid::page;
+
+SUITE(bit_field)
+{
+    TEST_CASE("bit field extraction")
+    {
+        static constexpr std::array<std::uint8_t, 4> data{0x12, 0xf4, 0x7f, 0x80};
+        static_assert(hid::extract_bits(data, 0, 8) == 0x12);
+        static_assert(hid::extract_bits(data, 4, 8) == 0x41);
+        static_assert(hid::extract_bits(data, 12, 12) == 0x7ff);
+        static_assert(hid::extract_bits(data, 0, 32) == 0x807ff412);
+        static_assert(hid::sign_extend(hid::extract_bits(data, 8, 8), 8) == -12);
+        static_assert(hid::sign_extend(hid::extract_bits(data, 12, 12), 12) == 2047);
+        static_assert(hid::sign_extend(0x800, 12) == -2048);
+        static_assert(hid::sign_extend(0x80000000, 32) == std::numeric_limits<std::int32_t>::min());
+
+        // the same byte order as packed_integer
+        packed_integer<3, std::uint32_t> packed = 0x123456;
+        auto raw = std::span<const std::uint8_t>(reinterpret_cast<const std::uint8_t*>(&packed),
+                                                 sizeof(packed));
+        CHECK(hid::extract_bits(raw, 0, 24) == 0x123456);
+        CHECK(hid::extract_bits(raw, 4, 16) == 0x2345);
+    };
+
+    TEST_CASE("bit field insertion")
+    {
+        static constexpr auto inserted = []()
+        {
+            std::array<std::uint8_t, 4> data{0xff, 0xff, 0xff, 0xff};
+            hid::insert_bits(data, 4, 12, 0xabc);
+            hid::insert_bits(data, 16, 3, 0);
+            return data;
+        }();
+        static_assert(inserted == std::array<std::uint8_t, 4>{0xcf, 0xab, 0xf8, 0xff});
+    };
+
+    TEST_CASE("bit field array shapes")
+    {
+        static_assert(hid::bit_field_array{3, 1, 1, 8}.shape() == hid::bit_field_shape::BIT);
+        static_assert(hid::bit_field_array{8, 8, 8, 2}.shape() == hid::bit_field_shape::BYTE);
+        static_assert(hid::bit_field_array{16, 16, 16, 2}.shape() == hid::bit_field_shape::WORD);
+        static_assert(hid::bit_field_array{0, 32, 64, 2}.shape() == hid::bit_field_shape::DWORD);
+        static_assert(hid::bit_field_array{4, 8, 8, 2}.shape() == hid::bit_field_shape::SHIFTED);
+        static_assert(hid::bit_field_array{0, 24, 24, 2}.shape() ==
+                      hid::bit_field_shape::SHIFTED);
+        static_assert(hid::bit_field_array{0, 12, 12, 2}.shape() ==
+                      hid::bit_field_shape::UNALIGNED);
+
+        // every shape must match the single field access
+        const std::array<hid::bit_field_array, 8> arrays{{
+            {3, 1, 1, 13, false},
+            {3, 1, 1, 13, true},
+            {8, 8, 8, 5, true},
+            {16, 16, 16, 3, false},
+            {0, 32, 32, 2, true},
+            {4, 8, 8, 5, false},
+            {5, 24, 24, 2, true},
+            {2, 12, 12, 4, true},
+        }};
+        std::array<std::uint8_t, 12> data{};
+        for (std::size_t i = 0; i < data.size(); ++i)
+        {
+            data[i] = static_cast<std::uint8_t>(0x93 + 57 * i);
+        }
+        for (const auto& array : arrays)
+        {
+            std::vector<std::int32_t> values(array.count);
+            hid::extract(data, array, values);
+            for (std::size_t i = 0; i < array.count; ++i)
+            {
+                auto raw = hid::extract_bits(data, array.element_bit_offset(i), array.bit_size);
+                CHECK(values[i] == (array.is_signed ? hid::sign_extend(raw, array.bit_size)
+                                                    : static_cast<std::int32_t>(raw)));
+            }
+
+            // writing back the values leaves the buffer unchanged
+            auto copy = data;
+            hid::insert(copy, array, values);
+            CHECK(copy == data);
+
+            std::fill(values.begin(), values.end(), 0);
+            hid::insert(copy, array, values);
+            hid::extract(copy, array, values);
+            CHECK(std::all_of(values.begin(), values.end(), [](auto v) { return v == 0; }));
+        }
+    };
+
+    TEST_CASE("bitset iteration")
+    {
+        hid::app::mouse::report<0, 12> report;
+        report.buttons.set(button(2));
+        report.buttons.set(button(9));
+        report.buttons.set(button(12));
+        std::vector<std::size_t> indexes;
+        hid::for_each_set_bit(std::span<const std::uint8_t>(report.data(), sizeof(report)), 0, 12,
+                              [&](std::size_t index) { indexes.push_back(index); });
+        CHECK(indexes == std::vector<std::size_t>{1, 8, 11});
+    };
+};
@@ -0,0 +1,98 @@
+#include "hid/app/keyboard.hpp"
+#include "hid/app/lamparray.hpp"
+#include "hid/app/mouse.hpp"
+#include "hid/composite_descriptor.hpp"
+#include "hid/report_layout.hpp"
+#include "test_framework.hpp"
+
+using namespace hid::page;
+
+namespace
+{
+constexpr auto lamp_array_descriptor()
+{
+    using namespace hid::app::lamparray;
+    using namespace hid::rdf;
+    using lighting = lighting_and_illumination;
+
+    // clang-format off
+    return descriptor(
+        usage_page<lighting>(),
+        usage(lighting::LAMP_ARRAY),
+        collection::application(
+            lamp_array_attributes_report_descriptor<11>(),
+            lamp_attributes_request_report_descriptor<12>(),
+            lamp_attributes_response_report_descriptor<13>(),
+            lamp_multi_update_report_descriptor<14, 8>(),
+            lamp_range_update_report_descriptor<15>(),
+            control_report_descriptor<16>()
+        )
+    );
+    // clang-format on
+}
+} // namespace
+
+SUITE(composite_descriptor_)
+{
+    TEST_CASE("report ID assignment")
+    {
+        using namespace hid::app;
+        using hid::report::type;
+        static constexpr auto keyboard_desc = keyboard::app_report_descriptor<0>();
+        static constexpr auto mouse_desc = mouse::app_report_descriptor<0>();
+        static constexpr auto composite =
+            hid::make_composite_descriptor<keyboard_desc, mouse_desc, lamp_array_descriptor()>();
+
+        // a report ID item is inserted into the top-level collections without report IDs
+        static_assert(composite.descriptor.size() ==
+                      (keyboard_desc.size() + 2 + mouse_desc.size() + 2 +
+                       lamp_array_descriptor().size()));
+        static_assert(composite.report_ids.size() == 8);
+        static_assert(composite.report_ids[0] == hid::report_id_mapping{0, 0, 1});
+        static_assert(composite.report_ids[1] == hid::report_id_mapping{1, 0, 2});
+        static_assert(composite.report_ids[2] == hid::report_id_mapping{2, 11, 3});
+        static_assert(composite.report_ids[7] == hid::report_id_mapping{2, 16, 8});
+
+        static_assert(composite.remap(0, keyboard::output_report<0>::selector()) ==
+                      keyboard::output_report<1>::selector());
+        static_assert(composite.remap(1, mouse::report<0>::selector()) ==
+                      mouse::report<2>::selector());
+        static_assert(composite.remap(2, hid::report::selector(type::FEATURE, 14)) ==
+                      hid::report::selector(type::FEATURE, 6));
+
+        constexpr auto rp = hid::report_protocol::from_descriptor<composite.descriptor>();
+        static_assert(rp.uses_report_ids());
+        static_assert(rp.input_report_count == 2);
+        static_assert(rp.output_report_count == 1);
+        static_assert(rp.feature_report_count == 6);
+
+        // the report IDs are dense, their reports keep their content
+        constexpr auto layout = hid::report_layout(hid::report_layout_table<composite.descriptor>);
+        static_assert(layout.report_size(mouse::report<2>::selector()) ==
+                      sizeof(mouse::report<2>));
+        static_assert(layout.find(mouse::report<2>::selector(), generic_desktop::X) != nullptr);
+        static_assert(layout.report_size(hid::report::selector(type::FEATURE, 6)) ==
+                      sizeof(lamparray::lamp_multi_update_report<6, 8>));
+        CHECK(hid::rdf::get_application_usage_id(
+                  hid::rdf::descriptor_view::from_descriptor<composite.descriptor>()) ==
+              generic_desktop::KEYBOARD);
+    };
+
+    TEST_CASE("single top-level collection")
+    {
+        using namespace hid::app;
+        // without report IDs the descriptor is unchanged
+        static constexpr auto keyboard_desc = keyboard::app_report_descriptor<0>();
+        static constexpr auto kb = hid::make_composite_descriptor<keyboard_desc>();
+        static_assert(kb.descriptor == keyboard_desc);
+        static_assert(kb.report_ids.empty());
+        static_assert(kb.remap(0, keyboard::keys_input_report<0>::selector()) ==
+                      keyboard::keys_input_report<0>::selector());
+
+        // with report IDs they are made dense
+        static constexpr auto lamps = hid::make_composite_descriptor<lamp_array_descriptor()>();
+        static_assert(lamps.descriptor.size() == lamp_array_descriptor().size());
+        static_assert(lamps.report_ids.size() == 6);
+        static_assert(lamps.report_ids[5] == hid::report_id_mapping{0, 16, 6});
+    };
+};
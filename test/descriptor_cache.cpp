@@ -0,0 +1,72 @@
+#include "hid/app/keyboard.hpp"
+#include "hid/app/mouse.hpp"
+#include "hid/descriptor_cache.hpp"
+#include "test_framework.hpp"
+
+using namespace hid::page;
+
+SUITE(descriptor_cache_)
+{
+    TEST_CASE("descriptor fingerprint")
+    {
+        static constexpr std::array<std::uint8_t, 1> a{'a'};
+        static_assert(hid::descriptor_fingerprint({}) == 0xcbf29ce484222325);
+        static_assert(hid::descriptor_fingerprint(a) == 0xaf63dc4c8601ec8c);
+    };
+
+    TEST_CASE("descriptor cache")
+    {
+        static constexpr auto mouse0 = hid::app::mouse::app_report_descriptor<0>();
+        static constexpr auto mouse1 = hid::app::mouse::app_report_descriptor<1>();
+        static constexpr auto keyboard = hid::app::keyboard::app_report_descriptor<0>();
+
+        hid::descriptor_cache cache(2);
+        auto first = cache.get(mouse0);
+        CHECK(cache.get(mouse0) == first);
+        CHECK(cache.stats().hits == 1);
+        CHECK(cache.stats().misses == 1);
+        CHECK(first->layout().size() == hid::make_report_layout_table<mouse0>().size());
+        CHECK(first->dispatch_table().find(hid::app::mouse::report<0>::selector()).size ==
+              sizeof(hid::app::mouse::report<0>));
+
+        // mouse0 is the least recently used when keyboard is added
+        auto second = cache.get(mouse1);
+        CHECK(cache.get(keyboard) != nullptr);
+        CHECK(cache.size() == 2);
+        CHECK(cache.stats().evictions == 1);
+        CHECK(cache.get(mouse1) == second);
+        CHECK(cache.get(mouse0) != first);
+        CHECK(first->descriptor().size() == mouse0.size());
+
+        // invalid descriptors aren't cached
+        static constexpr std::array<std::uint8_t, 2> invalid{0xc0, 0xc0};
+        auto misses = cache.stats().misses;
+        bool thrown = false;
+        try
+        {
+            (void)cache.get(invalid);
+        }
+        catch (const hid::rdf::exception&)
+        {
+            thrown = true;
+        }
+        CHECK(thrown);
+        CHECK(cache.stats().misses == misses + 1);
+        CHECK(cache.size() == 2);
+        // and they don't displace the cached ones
+        auto evictions = cache.stats().evictions;
+        CHECK(cache.get(mouse1) == second);
+        CHECK(cache.stats().evictions == evictions);
+
+        thrown = false;
+        try
+        {
+            hid::descriptor_cache empty(0);
+        }
+        catch (const hid::rdf::ex_cache_capacity_zero&)
+        {
+            thrown = true;
+        }
+        CHECK(thrown);
+    };
+};
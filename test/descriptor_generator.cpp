@@ -0,0 +1,105 @@
+#include <vector>
+#include "hid/descriptor_generator.hpp"
+#include "test_framework.hpp"
+
+namespace
+{
+std::vector<hid::report_field> parse_layout(const std::vector<hid::rdf::byte_type>& desc)
+{
+    using parser = hid::report_layout::parser<hid::rdf::reinterpret_iterator>;
+    auto desc_view = hid::rdf::descriptor_view(desc.data(), desc.size());
+    std::vector<hid::report_field> fields(parser(desc_view, {}).field_count());
+    parser(desc_view, fields);
+    return fields;
+}
+} // namespace
+
+SUITE(descriptor_generator_)
+{
+    TEST_CASE("generated descriptors are valid")
+    {
+        using policy = hid::descriptor_generator::data_size_policy;
+        for (std::uint64_t seed = 1; seed <= 20; ++seed)
+        {
+            hid::descriptor_generator::config config{
+                .seed = seed,
+                .tlc_count = static_cast<unsigned>(1 + (seed % 4)),
+                .nesting_depth = static_cast<unsigned>(1 + (seed % 3)),
+                .report_id_count = static_cast<unsigned>((seed % 5) * 3),
+                .fields_per_tlc = 16,
+                .push_pop = (seed % 2) == 0,
+                .data_sizes = static_cast<policy>(seed % 3),
+            };
+            auto desc = hid::descriptor_generator(config).generate();
+            CHECK(desc == hid::descriptor_generator(config).generate());
+
+            auto fields = parse_layout(desc);
+            CHECK(fields.size() >= 16);
+            auto desc_view = hid::rdf::descriptor_view(desc.data(), desc.size());
+            CHECK(hid::rdf::get_application_usage_id(desc_view) != hid::nullusage);
+        }
+    };
+
+    TEST_CASE("generated descriptor size")
+    {
+        for (std::size_t size : {4096U, 65536U})
+        {
+            auto desc = hid::descriptor_generator({.tlc_count = 8,
+                                                   .report_id_count = 255,
+                                                   .target_size = size,
+                                                   .push_pop = true})
+                            .generate();
+            CHECK(desc.size() >= size);
+            CHECK(desc.size() < (size + 1024));
+            CHECK(!parse_layout(desc).empty());
+
+            // the default capacity fits any descriptor, the compact one doesn't fit this many
+            using properties = hid::report_protocol_properties;
+            auto desc_view = hid::rdf::descriptor_view(desc.data(), desc.size());
+            CHECK(hid::get_report_protocol_properties(desc_view).report_count() >
+                  properties::compact_report_count);
+            bool thrown = false;
+            try
+            {
+                (void)hid::get_report_protocol_properties<properties::compact_report_count>(
+                    desc_view);
+            }
+            catch (const hid::rdf::ex_report_count_excess&)
+            {
+                thrown = true;
+            }
+            CHECK(thrown);
+        }
+    };
+
+    TEST_CASE("generated reports are valid")
+    {
+        auto desc = hid::descriptor_generator({.seed = 42, .report_id_count = 4}).generate();
+        auto fields = parse_layout(desc);
+        auto layout = hid::report_layout(fields);
+        hid::pseudo_random random(42);
+
+        const auto& first = layout.fields().front();
+        std::vector<std::uint8_t> report(layout.report_size(first.selector));
+        hid::generate_report(layout.fields(first.selector), random, report);
+        CHECK(report.front() == first.selector.id());
+
+        for (const auto& field : layout.fields(first.selector))
+        {
+            std::vector<std::int32_t> values(field.count);
+            hid::extract(report, field.elements(), values);
+            for (auto value : values)
+            {
+                if (field.is_padding())
+                {
+                    CHECK(value == 0);
+                }
+                else
+                {
+                    CHECK(value >= (field.is_array() ? 0 : field.logical_min));
+                    CHECK(value <= field.logical_max);
+                }
+            }
+        }
+    };
+};
@@ -0,0 +1,99 @@
+#include "hid/rdf/descriptor_optimizer.hpp"
+#include "hid/app/keyboard.hpp"
+#include "hid/app/lamparray.hpp"
+#include "hid/app/mouse.hpp"
+#include "hid/report_protocol.hpp"
+#include "test_framework.hpp"
+
+using namespace hid::rdf;
+
+namespace
+{
+constexpr auto lamparray_desc = descriptor(
+    // clang-format off
+    usage_page<hid::page::lighting_and_illumination>(),
+    usage(hid::page::lighting_and_illumination::LAMP_ARRAY),
+    collection::application(
+        hid::app::lamparray::lamp_array_attributes_report_descriptor<3>(),
+        hid::app::lamparray::lamp_attributes_request_report_descriptor<4>(),
+        hid::app::lamparray::lamp_attributes_response_report_descriptor<5>(),
+        hid::app::lamparray::lamp_multi_update_report_descriptor<6, 10>(),
+        hid::app::lamparray::lamp_range_update_report_descriptor<7>(),
+        hid::app::lamparray::control_report_descriptor<8>()
+    )
+    // clang-format on
+);
+constexpr auto composite_desc = descriptor(hid::app::keyboard::app_report_descriptor<1>(),
+                                           hid::app::mouse::app_report_descriptor<2>(),
+                                           lamparray_desc);
+} // namespace
+
+SUITE(descriptor_optimizer_)
+{
+    TEST_CASE("redundant globals removal")
+    {
+        constexpr auto optimized = make_optimized_descriptor<composite_desc>();
+        static_assert(optimized.size() < composite_desc.size());
+
+        // the report protocol is unchanged
+        constexpr auto rp = hid::report_protocol::from_descriptor<composite_desc>();
+        constexpr auto rp_optimized = hid::report_protocol::from_descriptor<optimized>();
+        static_assert(static_cast<const hid::report_protocol_properties&>(rp_optimized) ==
+                      static_cast<const hid::report_protocol_properties&>(rp));
+        constexpr auto table = hid::make_report_properties_table<composite_desc>();
+        constexpr auto table_optimized = hid::make_report_properties_table<optimized>();
+        static_assert(std::equal(table.begin(), table.end(), table_optimized.begin(),
+                                 table_optimized.end(), [](const auto& a, const auto& b)
+                                 { return (a.selector == b.selector) and (a.size == b.size); }));
+
+        // a second pass finds nothing to remove
+        static_assert(make_optimized_descriptor<optimized>() == optimized);
+
+        // the runtime result matches the compile-time one
+        std::array<byte_type, composite_desc.size()> buffer{};
+        auto size = remove_redundant_globals(descriptor_view(composite_desc), buffer);
+        CHECK(size == optimized.size());
+        CHECK(std::equal(optimized.begin(), optimized.end(), buffer.begin()));
+    };
+
+    TEST_CASE("redundant globals removal with push and pop")
+    {
+        constexpr auto desc = descriptor(
+            // clang-format off
+            logical_limits<1, 1>(0, 1),
+            push_globals(),
+            logical_limits<1, 1>(0, 1),
+            logical_max<2>(1),
+            report_size(8),
+            pop_globals(),
+            logical_max<1>(1),
+            report_size(8),
+            logical_max<1>(0xff)
+            // clang-format on
+        );
+        constexpr auto expected = descriptor(
+            // clang-format off
+            logical_limits<1, 1>(0, 1),
+            push_globals(),
+            report_size(8),
+            pop_globals(),
+            report_size(8),
+            logical_max<1>(0xff)
+            // clang-format on
+        );
+        static_assert(make_optimized_descriptor<desc>() == expected);
+        CHECK(remove_redundant_globals(descriptor_view(desc)) == expected.size());
+
+        std::array<byte_type, 4> small_buffer{};
+        bool thrown = false;
+        try
+        {
+            remove_redundant_globals(descriptor_view(desc), small_buffer);
+        }
+        catch (const ex_descriptor_buffer_overflow&)
+        {
+            thrown = true;
+        }
+        CHECK(thrown);
+    };
+};
@@ -0,0 +1,120 @@
+#include <vector>
+#include "hid/app/keyboard.hpp"
+#include "hid/app/mouse.hpp"
+#include "hid/rdf/descriptor_splitter.hpp"
+#include "hid/report_routing.hpp"
+#include "test_framework.hpp"
+
+using namespace hid::rdf;
+using namespace hid::page;
+
+SUITE(descriptor_splitter_)
+{
+    TEST_CASE("self-contained top-level collections")
+    {
+        static constexpr auto desc = descriptor(hid::app::keyboard::app_report_descriptor<1>(),
+                                                hid::app::mouse::app_report_descriptor<2>());
+        auto view = descriptor_view(desc);
+        constexpr auto sizes = split_tlcs(ce_descriptor_view(desc));
+        static_assert(sizes.slice_count == 2);
+
+        std::array<descriptor_slice, sizes.slice_count> slices{};
+        std::array<byte_type, sizes.prefix_size> prefixes{};
+        auto result = split_tlcs(view, slices, prefixes);
+        CHECK(result.slice_count == 2);
+        CHECK(slices[0].is_zero_copy());
+        CHECK(slices[0].items.data() == desc.data());
+        CHECK(slices[0].size() == hid::app::keyboard::app_report_descriptor<1>().size());
+        CHECK(slices[1].tlc_index == 1);
+        // the mouse sets all global items before using them, its usage page even twice
+        CHECK(slices[1].is_zero_copy());
+        CHECK(slices[1].items.data() == desc.data() + slices[0].size());
+
+        // each slice is a valid descriptor with the reports of its top-level collection
+        constexpr auto routing = hid::report_routing(hid::report_routing_table<desc>);
+        for (const auto& slice : slices)
+        {
+            std::vector<byte_type> buffer(slice.size());
+            slice.copy(buffer);
+            CHECK(hid::get_report_protocol_properties(descriptor_view(buffer)) ==
+                  routing.tlc_properties(slice.tlc_index));
+        }
+    };
+
+    TEST_CASE("inherited global state")
+    {
+        static constexpr auto desc = descriptor(
+            // clang-format off
+            usage_page<generic_desktop>(),
+            logical_limits<1, 1>(0, 100),
+            report_size(8),
+            report_count(1),
+            usage(generic_desktop::MOUSE),
+            collection::application(
+                report_id(1),
+                usage(generic_desktop::X),
+                input::absolute_variable(),
+                push_globals(),
+                report_count(2)
+            ),
+            usage(generic_desktop::JOYSTICK),
+            collection::application(
+                report_id(2),
+                usage(generic_desktop::Y),
+                usage(generic_desktop::Z),
+                input::absolute_variable(),
+                pop_globals(),
+                report_id(2),
+                usage(generic_desktop::WHEEL),
+                input::absolute_variable()
+            ),
+            report_size(16)
+            // clang-format on
+        );
+        // the pushed state is restored, the report ID is set before use, the rest is inherited
+        constexpr auto expected_prefix = descriptor(
+            // clang-format off
+            usage_page<generic_desktop>(),
+            logical_limits<1, 1>(0, 100),
+            report_size(8),
+            report_id(1),
+            report_count(1),
+            push_globals(),
+            report_count(2)
+            // clang-format on
+        );
+        auto view = descriptor_view(desc);
+        auto sizes = split_tlcs(view);
+        CHECK(sizes.slice_count == 2);
+        CHECK(sizes.prefix_size == expected_prefix.size());
+
+        std::array<descriptor_slice, 2> slices{};
+        std::array<byte_type, expected_prefix.size()> prefixes{};
+        split_tlcs(view, slices, prefixes);
+        CHECK(slices[0].is_zero_copy());
+        CHECK(std::ranges::equal(slices[1].prefix, expected_prefix));
+        // the trailing item belongs to the last slice
+        CHECK((slices[0].items.size() + slices[1].items.size()) == desc.size());
+
+        std::vector<byte_type> buffer(slices[1].size());
+        slices[1].copy(buffer);
+        auto props = hid::get_report_protocol_properties(descriptor_view(buffer));
+        CHECK(props.max_input_size == 1 + 3);
+        CHECK(props.input_report_count == 1);
+    };
+
+    TEST_CASE("descriptor without top-level collection")
+    {
+        static constexpr auto desc = descriptor(usage_page<generic_desktop>(), report_size(8));
+        bool thrown = false;
+        try
+        {
+            (void)split_tlcs(descriptor_view(desc));
+        }
+        catch (const ex_collection_missing&)
+        {
+            thrown = true;
+        }
+        CHECK(thrown);
+    };
+};
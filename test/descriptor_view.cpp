@@ -1,5 +1,8 @@
 #include "hid/rdf/descriptor_view.hpp"
 #include "hid/rdf/descriptor.hpp"
+#include "hid/page/button.hpp"
+#include "hid/page/consumer.hpp"
+#include "hid/page/generic_desktop.hpp"
 #include "test_framework.hpp"
 
 using namespace hid::rdf;
@@ -40,5 +43,80 @@ SUITE(descriptor_view_)
         CHECK(!descriptor_view(a2).has_valid_bounds());
         constexpr auto a3 = std::to_array<std::uint8_t>({0x03, 0x01, 0x23, 0x45});
         CHECK(!descriptor_view(a3).has_valid_bounds());
+
+        constexpr auto long_item = std::to_array<std::uint8_t>({0xfe, 0x02, 0x10, 0xa, 0xb});
+        CHECK(descriptor_view(long_item).has_valid_bounds());
+        CHECK(!descriptor_view(std::span(long_item).first(4)).has_valid_bounds());
+        CHECK(!descriptor_view(std::span(long_item).first(2)).has_valid_bounds());
+    };
+
+    TEST_CASE("descriptor - concatenation")
+    {
+        constexpr auto items = std::to_array<std::uint8_t>({0x15, 0x00, 0x25, 0x01, 0xa1, 0x01,
+                                                            0x75, 0x08, 0x95, 0x02, 0x81, 0x02,
+                                                            0xc0});
+        constexpr auto by_comma = (logical_min<1>(0), logical_max<1>(1),
+                                   main::collection_begin_item(main::collection_type::APPLICATION),
+                                   report_size(8), report_count(2), input::absolute_variable(),
+                                   main::collection_end_item());
+        constexpr auto by_concat = concat(logical_min<1>(0), logical_max<1>(1),
+                                          collection::application(report_size(8), report_count(2),
+                                                                  input::absolute_variable()));
+        constexpr auto by_descriptor =
+            descriptor(logical_min<1>(0), logical_max<1>(1),
+                       collection::application(report_size(8), report_count(2),
+                                               input::absolute_variable()));
+        static_assert(by_comma == items);
+        static_assert(by_concat == items);
+        static_assert(by_descriptor == items);
+        static_assert(concat(array<0>(), by_concat, array<0>()).size() == items.size());
+        CHECK(by_descriptor == items);
+    };
+
+    TEST_CASE("descriptor - minimal item data sizes")
+    {
+        using namespace hid::page;
+        static_assert(logical_limits<0, 1>() == logical_limits<0, 1>(0, 1));
+        static_assert(logical_limits<-127, 127>() == logical_limits<1, 1>(-127, 127));
+        static_assert(logical_limits<0, 255>() == logical_limits<0, 2>(0, 255));
+        static_assert(logical_limits<-32768, 65535>() == logical_limits<2, 4>(-32768, 65535));
+        static_assert(physical_limits<-1, 1000>() == physical_limits<1, 2>(-1, 1000));
+        static_assert(report_size<8>() == report_size<1>(8));
+        static_assert(report_count<256>() == report_count<2>(256));
+        static_assert(usage<generic_desktop::X>() == usage<1>(generic_desktop::X));
+        static_assert(usage<consumer::AC_PAN>() == usage<2>(consumer::AC_PAN));
+        static_assert(usage_limits<button(1), button(3)>() ==
+                      usage_limits<1, 1>(button(1), button(3)));
+        static_assert(unit::unit_exponent<0>().size() == 1);
+        static_assert(unit::unit_exponent<-2>() == unit::exponent(-2));
+
+        static_assert(signed_data_size(-129) == 2);
+        static_assert(unsigned_data_size(0x10000) == 4);
+        CHECK(signed_data_size(0) == 0);
+    };
+
+    TEST_CASE("descriptor - signed item data size boundaries")
+    {
+        static_assert(signed_data_size(127) == 1);
+        static_assert(signed_data_size(128) == 2);
+        static_assert(signed_data_size(-128) == 1);
+        static_assert(signed_data_size(-129) == 2);
+        static_assert(signed_data_size(32767) == 2);
+        static_assert(signed_data_size(32768) == 4);
+        static_assert(signed_data_size(-32768) == 2);
+        static_assert(signed_data_size(std::numeric_limits<std::int32_t>::max()) == 4);
+        static_assert(signed_data_size(std::numeric_limits<std::int32_t>::min()) == 4);
+
+        // the value would be read back as negative
+        bool thrown = false;
+        try
+        {
+            (void)signed_data_size(std::uint32_t{0x80000000});
+        }
+        catch (const ex_item_data_overflow&)
+        {
+            thrown = true;
+        }
+        CHECK(thrown);
     };
 };
@@ -58,6 +58,39 @@ SUITE(keyboard_)
                       hid::page::generic_desktop::KEYBOARD);
         CHECK(hid::rdf::get_application_usage_id(hid::rdf::descriptor_view(desc5)) ==
               hid::page::generic_desktop::KEYBOARD);
+
+        // the runtime properties match the compile-time ones
+        constexpr auto props5 =
+            hid::get_report_protocol_properties(hid::rdf::ce_descriptor_view(desc5));
+        static_assert(props5 == static_cast<const hid::report_protocol_properties&>(rp5));
+        CHECK(hid::get_report_protocol_properties(hid::rdf::descriptor_view(desc5)) == props5);
+        CHECK(hid::get_report_protocol_properties(
+                  hid::rdf::descriptor_view::from_descriptor<app_report_descriptor<0>()>()) ==
+              static_cast<const hid::report_protocol_properties&>(rp0));
+
+        // the parser's report table capacity can be reduced to the number of reports
+        static_assert(hid::get_report_protocol_properties<2>(hid::rdf::ce_descriptor_view(desc5)) ==
+                      props5);
+        static_assert(sizeof(hid::report_protocol_properties::parser<hid::rdf::reinterpret_iterator,
+                                                                     void, 2>) < 256);
+        // the compact parser is opt-in, the default capacity fits any descriptor
+        using compact_parser =
+            hid::report_protocol_properties::compact_parser<hid::rdf::reinterpret_iterator>;
+        static_assert(sizeof(compact_parser) < 512);
+        CHECK(hid::report_protocol_properties(compact_parser(hid::rdf::descriptor_view(desc5))) ==
+              props5);
+        static_assert(
+            sizeof(hid::report_protocol_properties::parser<hid::rdf::reinterpret_iterator>) > 4096);
+        bool thrown = false;
+        try
+        {
+            (void)hid::get_report_protocol_properties<1>(hid::rdf::descriptor_view(desc5));
+        }
+        catch (const hid::rdf::ex_report_count_excess&)
+        {
+            thrown = true;
+        }
+        CHECK(thrown);
     };
 
     TEST_CASE("report structures")
@@ -0,0 +1,106 @@
+#include <cstring>
+#include "hid/app/mouse.hpp"
+#include "hid/packed_report.hpp"
+#include "test_framework.hpp"
+
+using namespace hid::page;
+
+namespace
+{
+constexpr auto pointer_descriptor()
+{
+    using namespace hid::rdf;
+
+    // clang-format off
+    return descriptor(
+        usage_page<generic_desktop>(),
+        usage(generic_desktop::MOUSE),
+        collection::application(
+            report_id(2),
+            usage_page<button>(),
+            usage_limits<1, 1>(button(1), button(5)),
+            logical_limits<1, 1>(0, 1),
+            report_size(1),
+            report_count(5),
+            input::absolute_variable(),
+            usage_page<generic_desktop>(),
+            usage(generic_desktop::X),
+            usage(generic_desktop::Y),
+            logical_limits<2, 2>(-2047, 2047),
+            report_size(12),
+            report_count(2),
+            input::relative_variable(),
+            usage(generic_desktop::WHEEL),
+            logical_limits<1, 1>(-127, 127),
+            report_size(8),
+            report_count(1),
+            input::relative_variable(),
+            input::byte_padding<5 + 2 * 12 + 8>()
+        )
+    );
+    // clang-format on
+}
+} // namespace
+
+SUITE(packed_report_)
+{
+    TEST_CASE("mouse packed report")
+    {
+        using namespace hid::app::mouse;
+        using packed = hid::packed_report<app_report_descriptor<0>(), hid::report::type::INPUT>;
+        static_assert(sizeof(packed) == sizeof(report<0>));
+        static_assert(packed::selector() == report<0>::selector());
+        static_assert(hid::report::Data<packed>);
+        static_assert(packed::element<button(3)>().bit_offset == 2);
+        static_assert(packed::element<generic_desktop::Y>().bit_offset == 16);
+        static_assert(packed::element<generic_desktop::Y>().is_signed());
+
+        static constexpr auto values = []
+        {
+            packed r;
+            r.set<button(1)>(1);
+            r.set<button(3)>(1);
+            r.set<generic_desktop::X>(-5);
+            r.set<generic_desktop::Y>(100);
+            return r;
+        }();
+        static_assert(values.get<button(1)>() == 1);
+        static_assert(values.get<button(2)>() == 0);
+        static_assert(values.get<generic_desktop::X>() == -5);
+        static_assert(values.get<generic_desktop::Y>() == 100);
+
+        report<0> mouse_report;
+        mouse_report.x = -5;
+        mouse_report.y = 100;
+        mouse_report.buttons.set(button(1));
+        mouse_report.buttons.set(button(3));
+        CHECK(std::memcmp(values.data(), mouse_report.data(), sizeof(mouse_report)) == 0);
+    };
+
+    TEST_CASE("packed report with report ID and unaligned fields")
+    {
+        using packed = hid::packed_report<pointer_descriptor(), hid::report::type::INPUT, 2>;
+        static_assert(sizeof(packed) == 1 + 5);
+        static_assert(packed::size() == sizeof(packed));
+        static_assert(packed::element<generic_desktop::X>().bit_offset == 8 + 5);
+        static_assert(packed::element<generic_desktop::WHEEL>().bit_offset == 8 + 5 + 24);
+
+        packed r;
+        CHECK(r.id == 2);
+        r.set<generic_desktop::X>(-2047);
+        r.set<generic_desktop::Y>(2047);
+        r.set<generic_desktop::WHEEL>(-1);
+        r.set<button(5)>(1);
+        CHECK(r.get<generic_desktop::X>() == -2047);
+        CHECK(r.get<generic_desktop::Y>() == 2047);
+        CHECK(r.get<generic_desktop::WHEEL>() == -1);
+        CHECK(r.get<button(5)>() == 1);
+        CHECK(r.get<button(4)>() == 0);
+
+        // the neighbouring elements remain unchanged
+        r.set<generic_desktop::X>(0);
+        CHECK(r.get<generic_desktop::Y>() == 2047);
+        CHECK(r.get<button(5)>() == 1);
+        CHECK(r.data()[0] == 2);
+    };
+};
@@ -0,0 +1,136 @@
+#include <array>
+#include "hid/app/mouse.hpp"
+#include "hid/report_batch.hpp"
+#include "test_framework.hpp"
+
+using namespace hid::page;
+
+SUITE(report_batch)
+{
+    TEST_CASE("mouse report batch")
+    {
+        using namespace hid::app::mouse;
+        static constexpr auto layout =
+            hid::report_layout(hid::report_layout_table<app_report_descriptor<0>()>);
+        constexpr auto decoder = hid::report_batch_decoder(layout.fields(report<0>::selector()));
+        static_assert(decoder.column_count() == 5);
+        static_assert(decoder.report_size() == sizeof(report<0>));
+
+        constexpr std::size_t COUNT = 7;
+        std::array<report<0>, COUNT> reports{};
+        for (std::size_t i = 0; i < COUNT; ++i)
+        {
+            reports[i].buttons.set(button(1 + (i % 3)));
+            reports[i].x = static_cast<std::int8_t>(-100 + 30 * static_cast<int>(i));
+            reports[i].y = static_cast<std::int8_t>(i);
+        }
+        std::array<std::int32_t, COUNT * 5> columns{};
+        auto raw = std::span<const std::uint8_t>(reports.front().data(), sizeof(reports));
+        CHECK(decoder.decode(raw, sizeof(report<0>), columns) == COUNT);
+        for (std::size_t i = 0; i < COUNT; ++i)
+        {
+            for (std::size_t b = 0; b < 3; ++b)
+            {
+                CHECK(columns[b * COUNT + i] == ((i % 3) == b ? 1 : 0));
+            }
+            CHECK(columns[3 * COUNT + i] == reports[i].x);
+            CHECK(columns[4 * COUNT + i] == reports[i].y);
+        }
+    };
+
+    TEST_CASE("unaligned signed field batch")
+    {
+        using namespace hid::rdf;
+        // clang-format off
+        static constexpr auto desc = descriptor(
+            usage_page<generic_desktop>(),
+            usage(generic_desktop::JOYSTICK),
+            collection::application(
+                usage_extended_limits(generic_desktop::X, generic_desktop::Z),
+                logical_limits<2, 2>(-2048, 2047),
+                report_size(12),
+                report_count(3),
+                input::absolute_variable(),
+                input::byte_padding<36>()
+            )
+        );
+        // clang-format on
+        static constexpr auto layout = hid::report_layout(hid::report_layout_table<desc>);
+        constexpr auto decoder = hid::report_batch_decoder(layout.fields());
+        static_assert(decoder.column_count() == 3);
+        static_assert(decoder.report_size() == 5);
+
+        // reports with 3 bytes stride padding
+        constexpr std::size_t STRIDE = 8;
+        constexpr std::size_t COUNT = 4;
+        std::array<std::uint8_t, STRIDE * COUNT> raw{};
+        for (std::size_t i = 0; i < raw.size(); ++i)
+        {
+            raw[i] = static_cast<std::uint8_t>(0x5a + 37 * i);
+        }
+        std::array<std::int32_t, 3 * COUNT> columns{};
+        CHECK(decoder.decode(raw, STRIDE, columns) == COUNT);
+        for (std::size_t i = 0; i < COUNT; ++i)
+        {
+            auto report = std::span<const std::uint8_t>(raw).subspan(i * STRIDE, STRIDE);
+            for (std::size_t c = 0; c < 3; ++c)
+            {
+                CHECK(columns[c * COUNT + i] ==
+                      hid::sign_extend(hid::extract_bits(report, c * 12, 12), 12));
+            }
+        }
+    };
+
+    TEST_CASE("large batch of tightly packed reports")
+    {
+        using namespace hid::rdf;
+        // clang-format off
+        static constexpr auto desc = descriptor(
+            usage_page<generic_desktop>(),
+            usage(generic_desktop::JOYSTICK),
+            collection::application(
+                usage_extended_limits(generic_desktop::X, generic_desktop::RZ),
+                logical_limits<2, 2>(-2048, 2047),
+                report_size(12),
+                report_count(6),
+                input::absolute_variable(),
+                usage_page<button>(),
+                usage_limits(button(1), button(16)),
+                logical_limits<1, 1>(0, 1),
+                report_size(1),
+                report_count(16),
+                input::absolute_variable()
+            )
+        );
+        // clang-format on
+        static constexpr auto layout = hid::report_layout(hid::report_layout_table<desc>);
+        constexpr auto decoder = hid::report_batch_decoder(layout.fields());
+        static_assert(decoder.column_count() == 6 + 16);
+        static_assert(decoder.report_size() == 11);
+
+        // the count isn't a multiple of the SIMD width, and the last report ends the buffer
+        constexpr std::size_t STRIDE = decoder.report_size();
+        constexpr std::size_t COUNT = 37;
+        std::array<std::uint8_t, STRIDE * COUNT> raw{};
+        for (std::size_t i = 0; i < raw.size(); ++i)
+        {
+            raw[i] = static_cast<std::uint8_t>(0x3c + 73 * i);
+        }
+        std::array<std::int32_t, decoder.column_count() * COUNT> columns{};
+        CHECK(decoder.decode(raw, STRIDE, columns) == COUNT);
+        for (std::size_t i = 0; i < COUNT; ++i)
+        {
+            auto report = std::span<const std::uint8_t>(raw).subspan(i * STRIDE, STRIDE);
+            for (std::size_t c = 0; c < 6; ++c)
+            {
+                CHECK(columns[c * COUNT + i] ==
+                      hid::sign_extend(hid::extract_bits(report, c * 12, 12), 12));
+            }
+            for (std::size_t b = 0; b < 16; ++b)
+            {
+                CHECK(columns[(6 + b) * COUNT + i] ==
+                      static_cast<std::int32_t>(hid::extract_bits(report, 72 + b, 1)));
+            }
+        }
+    };
+};
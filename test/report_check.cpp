@@ -0,0 +1,101 @@
+#include "hid/app/keyboard.hpp"
+#include "hid/app/lamparray.hpp"
+#include "hid/app/mouse.hpp"
+#include "hid/report_check.hpp"
+#include "test_framework.hpp"
+
+using namespace hid::page;
+
+SUITE(report_check_)
+{
+    TEST_CASE("keyboard and mouse reports match their descriptors")
+    {
+        using namespace hid::app;
+        static constexpr auto kb_desc = keyboard::app_report_descriptor<3>();
+        using keys = keyboard::keys_input_report<3>;
+        static_assert(hid::report_matches_descriptor<kb_desc, keys>());
+        static_assert(hid::report_matches_descriptor<kb_desc, keyboard::output_report<3>>());
+        static_assert(hid::member_byte_offset(&keys::reserved) == 2);
+        static_assert(hid::field_matches_descriptor<kb_desc, keys, keyboard_keypad::KEYBOARD_A>(
+            &keys::scancodes));
+        static_assert(hid::field_matches_descriptor<kb_desc, keys,
+                                                    keyboard_keypad::KEYBOARD_LEFT_CONTROL>(
+            &keys::modifiers) == false);
+
+        static constexpr auto mouse_desc = mouse::app_report_descriptor<0>();
+        using mouse_report = mouse::report<0>;
+        static_assert(hid::report_matches_descriptor<mouse_desc, mouse_report>());
+        static_assert(hid::field_matches_descriptor<mouse_desc, mouse_report, generic_desktop::X>(
+            &mouse_report::x));
+        static_assert(hid::field_matches_descriptor<mouse_desc, mouse_report, generic_desktop::Y>(
+            &mouse_report::y));
+        // swapped members are detected
+        static_assert(not hid::field_matches_descriptor<mouse_desc, mouse_report,
+                                                        generic_desktop::X>(&mouse_report::y));
+        // the selector isn't defined
+        static_assert(hid::descriptor_report_size<mouse_desc>(mouse::report<1>::selector()) == 0);
+    };
+
+    TEST_CASE("lamp array reports match their descriptors")
+    {
+        using namespace hid::app::lamparray;
+        using namespace hid::rdf;
+        using lighting = lighting_and_illumination;
+        static constexpr auto desc = descriptor(
+            // clang-format off
+            usage_page<lighting>(),
+            usage(lighting::LAMP_ARRAY),
+            collection::application(
+                lamp_array_attributes_report_descriptor<1>(),
+                lamp_attributes_request_report_descriptor<2>(),
+                lamp_attributes_response_report_descriptor<3>(),
+                lamp_multi_update_report_descriptor<4, 8>(),
+                lamp_range_update_report_descriptor<5>(),
+                control_report_descriptor<6>()
+            )
+            // clang-format on
+        );
+        static_assert(hid::report_matches_descriptor<desc, lamp_array_attributes_report<1>>());
+        static_assert(hid::report_matches_descriptor<desc, lamp_attributes_request_report<2>>());
+        static_assert(hid::report_matches_descriptor<desc, lamp_attributes_response_report<3>>());
+        static_assert(hid::report_matches_descriptor<desc, lamp_multi_update_report<4, 8>>());
+        static_assert(hid::report_matches_descriptor<desc, lamp_range_update_report<5>>());
+        static_assert(hid::report_matches_descriptor<desc, control_report<6>>());
+
+        using response = lamp_attributes_response_report<3>;
+        static_assert(hid::field_matches_descriptor<desc, response, lighting::UPDATE_LATENCY_US>(
+            &response::update_latency));
+        static_assert(hid::field_matches_descriptor<desc, response, lighting::INPUT_BINDING>(
+            &response::input_binding));
+        using multi_update = lamp_multi_update_report<4, 8>;
+        static_assert(hid::field_matches_descriptor<desc, multi_update, lighting::LAMP_ID>(
+            &multi_update::lamp_ids));
+        static_assert(
+            hid::field_matches_descriptor<desc, multi_update, lighting::RED_UPDATE_CHANNEL>(
+                &multi_update::values));
+    };
+
+    TEST_CASE("lamp multi update reports with wide report counts")
+    {
+        using namespace hid::app::lamparray;
+        using namespace hid::rdf;
+        using lighting = lighting_and_illumination;
+        // the report counts of 64 and more lamps need 2-byte items
+        static constexpr auto desc = descriptor(
+            // clang-format off
+            usage_page<lighting>(),
+            usage(lighting::LAMP_ARRAY),
+            collection::application(
+                lamp_multi_update_report_descriptor<1, 64>(),
+                lamp_multi_update_report_descriptor<2, 127>()
+            )
+            // clang-format on
+        );
+        static_assert(hid::report_matches_descriptor<desc, lamp_multi_update_report<1, 64>>());
+        static_assert(hid::report_matches_descriptor<desc, lamp_multi_update_report<2, 127>>());
+        using multi_update = lamp_multi_update_report<2, 127>;
+        static_assert(
+            hid::field_matches_descriptor<desc, multi_update, lighting::RED_UPDATE_CHANNEL>(
+                &multi_update::values));
+    };
+};
@@ -0,0 +1,185 @@
+#include <vector>
+#include "hid/app/keyboard.hpp"
+#include "hid/app/mouse.hpp"
+#include "hid/report_dispatch_table.hpp"
+#include "hid/report_layout.hpp"
+#include "test_framework.hpp"
+
+using namespace hid::page;
+
+SUITE(report_layout_)
+{
+    TEST_CASE("mouse report layout")
+    {
+        using namespace hid::app::mouse;
+        static constexpr auto table0 = hid::make_report_layout_table<app_report_descriptor<0>()>();
+        constexpr auto layout0 = hid::report_layout(table0);
+        static_assert(layout0.size() == 3);
+        static_assert(layout0.report_size(report<0>::selector()) == sizeof(report<0>));
+
+        constexpr auto buttons = layout0.fields(report<0>::selector())[0];
+        static_assert(buttons.bit_offset == 0);
+        static_assert(buttons.bit_size == 1);
+        static_assert(buttons.count == 3);
+        static_assert(buttons.usage_min == button(1));
+        static_assert(buttons.usage_max == button(3));
+        static_assert(not buttons.is_signed());
+
+        constexpr auto padding = layout0.fields(report<0>::selector())[1];
+        static_assert(padding.is_padding());
+        static_assert(padding.is_constant());
+        static_assert(padding.bit_offset == 3);
+        static_assert(padding.bit_length() == 5);
+
+        constexpr const auto* axes = layout0.find(report<0>::selector(), generic_desktop::Y);
+        static_assert(axes->bit_offset == 8);
+        static_assert(axes->bit_size == 8);
+        static_assert(axes->count == 2);
+        static_assert(axes->usage_index(generic_desktop::Y) == 1);
+        static_assert(axes->element_bit_offset(1) == 16);
+        static_assert(axes->is_relative());
+        static_assert(axes->is_signed());
+        static_assert(axes->logical_min == -127);
+        static_assert(axes->physical_max == 127);
+        static_assert(layout0.find(report<0>::selector(), generic_desktop::WHEEL) == nullptr);
+
+        static constexpr auto table5 = hid::make_report_layout_table<app_report_descriptor<5>()>();
+        constexpr auto layout5 = hid::report_layout(table5);
+        static_assert(layout5.fields(report<0>::selector()).empty());
+        static_assert(layout5.report_size(report<5>::selector()) == sizeof(report<5>));
+        static_assert(layout5.find(report<5>::selector(), generic_desktop::X)->bit_offset == 16);
+
+        // runtime parsing gives the same result
+        static constexpr auto desc5 = app_report_descriptor<5>();
+        auto view5 = hid::rdf::descriptor_view(desc5);
+        auto count = hid::report_layout::parser<hid::rdf::reinterpret_iterator>(view5, {})
+                         .field_count();
+        CHECK(count == table5.size());
+        std::vector<hid::report_field> fields(count);
+        hid::report_layout::parser<hid::rdf::reinterpret_iterator> parser(view5, fields);
+        CHECK(std::ranges::equal(parser.layout(), table5));
+    };
+
+    TEST_CASE("keyboard report layout")
+    {
+        using namespace hid::app::keyboard;
+        static constexpr auto table = hid::make_report_layout_table<app_report_descriptor<0>()>();
+        constexpr auto layout = hid::report_layout(table);
+        static_assert(layout.size() == 5);
+        static_assert(layout.report_size(keys_input_report<0>::selector()) ==
+                      sizeof(keys_input_report<0>));
+        static_assert(layout.report_size(output_report<0>::selector()) ==
+                      sizeof(output_report<0>));
+
+        constexpr const auto* modifiers =
+            layout.find(keys_input_report<0>::selector(), keyboard_keypad::KEYBOARD_LEFT_SHIFT);
+        static_assert(modifiers->is_variable());
+        static_assert(modifiers->count == 8);
+        static_assert(modifiers->usage(1) == keyboard_keypad::KEYBOARD_LEFT_SHIFT);
+
+        constexpr const auto* keys =
+            layout.find(keys_input_report<0>::selector(), keyboard_keypad::KEYBOARD_A);
+        static_assert(keys->is_array());
+        static_assert(keys->bit_offset == 16);
+        static_assert(keys->count == 6);
+        static_assert(keys->usage_max == keyboard_keypad::KEYPAD_HEXADECIMAL);
+
+        constexpr const auto* leds =
+            layout.find(output_report<0>::selector(), hid::page::leds::CAPS_LOCK);
+        static_assert(leds->usage_index(hid::page::leds::CAPS_LOCK) == 1);
+        static_assert(layout.fields(output_report<0>::selector()).back().is_padding());
+    };
+
+    TEST_CASE("compile-time field lookup")
+    {
+        using namespace hid::app;
+        using hid::report::type;
+        static constexpr auto mouse_desc = mouse::app_report_descriptor<4>();
+        constexpr auto y = hid::field_of<mouse_desc, type::INPUT, 4, generic_desktop::Y>();
+        static_assert(y.bit_offset == 8 + 16);
+        static_assert(y.bit_size == 8);
+        static_assert(y.count == 1);
+        static_assert(y.is_signed());
+        constexpr auto b2 = hid::field_of<mouse_desc, type::INPUT, 4, button(2)>();
+        static_assert(b2.bit_offset == 8 + 1);
+        static_assert(b2.bit_size == 1);
+        static_assert(not b2.is_signed());
+
+        static constexpr auto kb_desc = keyboard::app_report_descriptor<0>();
+        constexpr auto keys = hid::field_of<kb_desc, type::INPUT, 0, keyboard_keypad::KEYBOARD_A>();
+        static_assert(keys.is_array());
+        static_assert(keys.count == 6);
+
+        mouse::report<4> mouse_report;
+        mouse_report.y = -42;
+        mouse_report.buttons.set(button(2));
+        auto bytes = std::span<std::uint8_t>(mouse_report.data(), sizeof(mouse_report));
+        CHECK(hid::get_field_value<mouse_desc, type::INPUT, 4, generic_desktop::Y>(bytes) == -42);
+        CHECK(hid::get_field_value<mouse_desc, type::INPUT, 4, button(2)>(bytes) == 1);
+        CHECK(hid::get_field_value<mouse_desc, type::INPUT, 4, button(3)>(bytes) == 0);
+        hid::set_field_value<mouse_desc, type::INPUT, 4, generic_desktop::X>(bytes, 17);
+        hid::set_field_value<mouse_desc, type::INPUT, 4, button(2)>(bytes, 0);
+        CHECK(mouse_report.x == 17);
+        CHECK(mouse_report.y == -42);
+        CHECK(not mouse_report.buttons.test(button(2)));
+    };
+
+    TEST_CASE("repeated last usage")
+    {
+        using namespace hid::rdf;
+        static constexpr auto desc = descriptor(
+            // clang-format off
+            usage_page<generic_desktop>(),
+            usage(generic_desktop::POINTER),
+            collection::application(
+                usage(generic_desktop::X),
+                usage(generic_desktop::Z),
+                logical_limits<1, 1>(0, 100),
+                report_size(8),
+                report_count(4),
+                input::absolute_variable()
+            )
+            // clang-format on
+        );
+        static constexpr auto table = hid::make_report_layout_table<desc>();
+        static_assert(table.size() == 3);
+        static_assert(table[0].usage_min == generic_desktop::X);
+        static_assert(table[0].count == 1);
+        static_assert(table[1].usage_min == generic_desktop::Z);
+        static_assert(table[1].count == 1);
+        static_assert(table[2].bit_offset == 16);
+        static_assert(table[2].count == 2);
+        static_assert(table[2].usage(1) == generic_desktop::Z);
+
+        constexpr auto select = hid::report::selector(hid::report::type::INPUT);
+        static_assert(hid::report_layout(table).usage_count(select, generic_desktop::X) == 1);
+        static_assert(hid::report_layout(table).usage_count(select, generic_desktop::Z) == 3);
+        static_assert(hid::report_layout(table).usage_count(select, generic_desktop::Y) == 0);
+    };
+
+    TEST_CASE("report dispatch table")
+    {
+        using namespace hid::app;
+        using namespace hid::rdf;
+        static constexpr auto desc = descriptor(keyboard::app_report_descriptor<1>(),
+                                                mouse::app_report_descriptor<2>());
+        static constexpr auto table = hid::make_report_dispatch_table<desc>();
+        static_assert(table.uses_report_ids());
+        static_assert(table.find(keyboard::keys_input_report<1>::selector()).size ==
+                      sizeof(keyboard::keys_input_report<1>));
+        static_assert(table.find(keyboard::output_report<1>::selector()).size ==
+                      sizeof(keyboard::output_report<1>));
+        static_assert(table.find(mouse::report<2>::selector()).size == sizeof(mouse::report<2>));
+        static_assert(not table.find(mouse::report<3>::selector()).valid());
+        static_assert(table.fields(table.find(mouse::report<2>::selector())).size() == 3);
+
+        mouse::report<2> mouse_report;
+        auto raw = std::span<const std::uint8_t>(mouse_report.data(), sizeof(mouse_report));
+        auto fields = table.fields(hid::report::type::INPUT, raw);
+        CHECK(fields.size() == 3);
+        CHECK(fields.front().selector == mouse::report<2>::selector());
+        CHECK(table.fields(hid::report::type::INPUT, raw.first(2)).empty());
+        CHECK(table.fields(hid::report::type::OUTPUT, raw).empty());
+        CHECK(table.fields(hid::report::type::INPUT, {}).empty());
+    };
+};
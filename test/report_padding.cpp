@@ -0,0 +1,144 @@
+#include "hid/report_padding.hpp"
+#include "hid/app/mouse.hpp"
+#include "hid/page/button.hpp"
+#include "hid/page/generic_desktop.hpp"
+#include "test_framework.hpp"
+
+using namespace hid;
+
+namespace
+{
+constexpr auto padded_desc = []()
+{
+    using namespace hid::rdf;
+    using namespace hid::page;
+    // clang-format off
+    return descriptor(
+        usage_page<generic_desktop>(),
+        usage(generic_desktop::MOUSE),
+        collection::application(
+            usage_page<button>(),
+            usage_limits(button(1), button(3)),
+            logical_limits<1, 1>(0, 1),
+            report_size(1),
+            report_count(3),
+            input::absolute_variable(),
+            input::padding(5),
+            usage_page<generic_desktop>(),
+            usage(generic_desktop::X),
+            logical_limits<1, 1>(-127, 127),
+            report_size(8),
+            report_count(1),
+            input::relative_variable(),
+            usage_page<button>(),
+            usage_limits(button(4), button(5)),
+            logical_limits<1, 1>(0, 1),
+            report_size(1),
+            report_count(2),
+            input::absolute_variable(),
+            input::padding(6)
+        )
+    );
+    // clang-format on
+}();
+constexpr auto buffered_desc = []()
+{
+    using namespace hid::rdf;
+    using namespace hid::page;
+    // clang-format off
+    return descriptor(
+        usage_page<generic_desktop>(),
+        usage(generic_desktop::MOUSE),
+        collection::application(
+            usage_page<button>(),
+            usage_limits(button(1), button(3)),
+            logical_limits<1, 1>(0, 1),
+            report_size(1),
+            report_count(3),
+            input::absolute_variable(),
+            input::padding(5),
+            usage_page<generic_desktop>(),
+            usage(generic_desktop::POINTER),
+            collection::physical(
+                usage(generic_desktop::X),
+                logical_limits<1, 2>(0, 255),
+                report_size(8),
+                report_count(2),
+                input::buffered_variable(),
+                usage(generic_desktop::Y),
+                logical_limits<1, 1>(-127, 127),
+                report_size(8),
+                report_count(1),
+                input::relative_variable()
+            )
+        )
+    );
+    // clang-format on
+}();
+constexpr auto input_report = report::selector(report::type::INPUT, 0);
+} // namespace
+
+SUITE(report_padding_)
+{
+    TEST_CASE("padding analysis")
+    {
+        constexpr auto fields = make_padding_fields_table<padded_desc>();
+        static_assert(fields.size() == 5);
+        static_assert(fields[1].is_padding and fields[4].is_padding);
+        static_assert(!fields[0].is_padding and !fields[2].is_padding);
+
+        constexpr auto padding = analyze_padding(fields, input_report);
+        static_assert(padding.size == 3);
+        static_assert(padding.padding_bits == 11);
+        static_assert(padding.packed_size == 2);
+        static_assert(padding.overhead() == 1);
+
+        constexpr auto mouse_fields =
+            make_padding_fields_table<hid::app::mouse::app_report_descriptor<1>()>();
+        constexpr auto mouse_padding =
+            analyze_padding(mouse_fields, report::selector(report::type::INPUT, 1));
+        static_assert(mouse_padding.overhead() == 0);
+        CHECK(analyze_padding(fields, input_report) == padding);
+    };
+
+    TEST_CASE("field order proposal")
+    {
+        constexpr auto fields = make_padding_fields_table<padded_desc>();
+        static_assert(propose_field_order(fields, input_report, {}) == 4);
+
+        std::array<padding_field, 4> proposal{};
+        CHECK(propose_field_order(fields, input_report, proposal) == proposal.size());
+        // the byte sized field goes first, the padding is merged to the end
+        CHECK(proposal[0].index == 2);
+        CHECK(proposal[0].bit_offset == 0);
+        CHECK(proposal[1].index == 0);
+        CHECK(proposal[1].bit_offset == 8);
+        CHECK(proposal[2].index == 3);
+        CHECK(proposal[2].bit_offset == 11);
+        CHECK(proposal[3].is_padding);
+        CHECK(proposal[3].bit_offset == 13);
+        CHECK(proposal[3].bit_end() == 16);
+        CHECK(analyze_padding(proposal, input_report).size == 2);
+    };
+
+    TEST_CASE("field order proposal keeps buffered bytes aligned")
+    {
+        constexpr auto fields = make_padding_fields_table<buffered_desc>();
+        static_assert(fields.size() == 4);
+        static_assert(fields[2].must_be_byte_aligned() and !fields[3].must_be_byte_aligned());
+
+        // without its padding, the first group of siblings ends unaligned
+        std::array<padding_field, 4> proposal{};
+        CHECK(propose_field_order(fields, input_report, proposal) == proposal.size());
+        CHECK(proposal[0].index == 0);
+        CHECK(proposal[0].bit_offset == 0);
+        CHECK(proposal[1].is_padding);
+        CHECK(proposal[1].bit_offset == 3);
+        CHECK(proposal[1].bit_end() == 8);
+        CHECK(proposal[2].index == 2);
+        CHECK(proposal[2].bit_offset == 8);
+        CHECK(proposal[3].index == 3);
+        CHECK(proposal[3].bit_offset == 24);
+        CHECK(analyze_padding(proposal, input_report).size == 4);
+    };
+};
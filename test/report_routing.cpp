@@ -0,0 +1,80 @@
+#include <vector>
+#include "hid/app/keyboard.hpp"
+#include "hid/app/mouse.hpp"
+#include "hid/report_routing.hpp"
+#include "test_framework.hpp"
+
+using namespace hid::page;
+
+SUITE(report_routing_)
+{
+    TEST_CASE("composite device report routing")
+    {
+        using namespace hid::app;
+        static constexpr auto desc = hid::rdf::descriptor(keyboard::app_report_descriptor<1>(),
+                                                          mouse::app_report_descriptor<2>(),
+                                                          mouse::app_report_descriptor<3>());
+        static constexpr auto table = hid::make_report_routing_table<desc>();
+        constexpr auto routing = hid::report_routing(table);
+        static_assert(routing.size() == 4);
+        static_assert(routing.tlc_count() == 3);
+        static_assert(std::ranges::is_sorted(
+            table, {},
+            [](const hid::report_route& route)
+            { return static_cast<std::uint16_t>(route.selector); }));
+
+        constexpr const auto* keys = routing.find(keyboard::keys_input_report<1>::selector());
+        static_assert(keys->tlc_index == 0);
+        static_assert(keys->application == generic_desktop::KEYBOARD);
+        static_assert(routing.find(keyboard::output_report<1>::selector())->tlc_index == 0);
+        constexpr const auto* second_mouse = routing.find(mouse::report<3>::selector());
+        static_assert(second_mouse->tlc_index == 2);
+        static_assert(second_mouse->application == generic_desktop::MOUSE);
+        static_assert(routing.find(mouse::report<4>::selector()) == nullptr);
+        static_assert(routing.find(keyboard::output_report<2>::selector()) == nullptr);
+
+        static_assert(keys->size == sizeof(keyboard::keys_input_report<1>));
+        static_assert(second_mouse->size == sizeof(mouse::report<3>));
+
+        // each top-level collection's buffers can be sized separately
+        constexpr auto keyboard_props = routing.tlc_properties(0);
+        static_assert(keyboard_props.max_input_size == sizeof(keyboard::keys_input_report<1>));
+        static_assert(keyboard_props.max_output_size == sizeof(keyboard::output_report<1>));
+        static_assert(keyboard_props.max_feature_size == 0);
+        static_assert(keyboard_props.input_report_count == 1);
+        static_assert(keyboard_props.output_report_count == 1);
+        static_assert(keyboard_props.uses_report_ids());
+        constexpr auto tlc_table = hid::make_tlc_properties_table<desc>();
+        static_assert(tlc_table.size() == 3);
+        static_assert(tlc_table[0] == keyboard_props);
+        static_assert(tlc_table[1].max_report_size() == sizeof(mouse::report<2>));
+        static_assert(tlc_table[2].report_count() == 1);
+        static_assert(tlc_table[2].max_output_size == 0);
+
+        // runtime parsing gives the same result
+        auto view = hid::rdf::descriptor_view(desc);
+        auto count = hid::report_routing::parser<hid::rdf::reinterpret_iterator>(view, {})
+                         .route_count();
+        CHECK(count == table.size());
+        std::vector<hid::report_route> routes(count);
+        hid::report_routing::parser<hid::rdf::reinterpret_iterator> parser(view, routes);
+        CHECK(std::ranges::equal(parser.routing(), table));
+        CHECK(parser.routing().find(mouse::report<2>::selector())->tlc_index == 1);
+        CHECK(parser.routing().tlc_properties(1) == tlc_table[1]);
+    };
+
+    TEST_CASE("single collection report routing")
+    {
+        using namespace hid::app;
+        static constexpr auto table =
+            hid::make_report_routing_table<keyboard::app_report_descriptor<0>()>();
+        constexpr auto routing = hid::report_routing(table);
+        static_assert(routing.size() == 2);
+        static_assert(routing.tlc_count() == 1);
+        static_assert(routing.find(keyboard::output_report<0>::selector())->application ==
+                      generic_desktop::KEYBOARD);
+        constexpr hid::report_protocol_properties props =
+            hid::report_protocol::from_descriptor<keyboard::app_report_descriptor<0>()>();
+        static_assert(routing.tlc_properties(0) == props);
+    };
+};
@@ -0,0 +1,75 @@
+#include <vector>
+#include "hid/app/keyboard.hpp"
+#include "hid/app/mouse.hpp"
+#include "hid/report_view.hpp"
+#include "test_framework.hpp"
+
+using namespace hid::page;
+
+SUITE(report_view_)
+{
+    TEST_CASE("mouse report view")
+    {
+        using namespace hid::app::mouse;
+        static constexpr auto layout =
+            hid::report_layout(hid::report_layout_table<app_report_descriptor<0>()>);
+
+        report<0> mouse_report;
+        mouse_report.x = -5;
+        mouse_report.y = 100;
+        mouse_report.buttons.set(button(1));
+        mouse_report.buttons.set(button(3));
+        auto view = hid::report_view(layout.fields(report<0>::selector()),
+                                     {mouse_report.data(), sizeof(mouse_report)});
+        CHECK(view.selector() == report<0>::selector());
+        CHECK(view.get(generic_desktop::X) == -5);
+        CHECK(view.get(generic_desktop::Y) == 100);
+        CHECK(view.get(button(1)) == 1);
+        CHECK(view.get(button(2)) == 0);
+        CHECK(not view.get(generic_desktop::WHEEL).has_value());
+
+        std::array<std::int32_t, 2> axes{};
+        CHECK(view.get_array(generic_desktop::Y, axes) == 2);
+        CHECK(axes == std::array<std::int32_t, 2>{-5, 100});
+
+        std::vector<hid::usage_t> active;
+        view.for_each_active_usage([&](hid::usage_t usage) { active.push_back(usage); });
+        CHECK(active == std::vector<hid::usage_t>{button(1), button(3)});
+    };
+
+    TEST_CASE("keyboard report views")
+    {
+        using namespace hid::app::keyboard;
+        static constexpr auto desc = app_report_descriptor<1>();
+        static constexpr auto table = hid::make_report_dispatch_table<desc>();
+
+        keys_input_report<1> keys;
+        keys.set_key_state(keyboard_keypad::KEYBOARD_LEFT_SHIFT, true);
+        keys.set_key_state(keyboard_keypad::KEYBOARD_A, true);
+        auto view = hid::report_view(table, hid::report::type::INPUT,
+                                     {keys.data(), sizeof(keys)});
+        CHECK(not view.empty());
+        std::vector<hid::usage_t> active;
+        view.for_each_active_usage([&](hid::usage_t usage) { active.push_back(usage); });
+        CHECK(active == std::vector<hid::usage_t>{keyboard_keypad::KEYBOARD_LEFT_SHIFT,
+                                                  keyboard_keypad::KEYBOARD_A});
+
+        // unknown report
+        CHECK(hid::report_view(table, hid::report::type::FEATURE, {keys.data(), sizeof(keys)})
+                  .empty());
+
+        // composing an output report in place
+        std::array<std::uint8_t, sizeof(output_report<1>)> buffer{};
+        buffer.fill(0xff);
+        auto out = hid::mutable_report_view(table.fields(table.find(output_report<1>::selector())),
+                                            buffer);
+        out.clear();
+        CHECK(out.set(leds::CAPS_LOCK, 1));
+        CHECK(not out.set(keyboard_keypad::KEYBOARD_A, 1));
+
+        output_report<1> expected;
+        expected.leds.set(leds::CAPS_LOCK);
+        CHECK(std::ranges::equal(buffer, std::span(expected.data(), sizeof(expected))));
+        CHECK(hid::report_view(out.fields(), buffer).get(leds::CAPS_LOCK) == 1);
+    };
+};
@@ -0,0 +1,198 @@
+#include <vector>
+#include "hid/app/keyboard.hpp"
+#include "hid/app/mouse.hpp"
+#include "hid/rdf/stream_parser.hpp"
+#include "test_framework.hpp"
+
+using namespace hid::rdf;
+
+namespace
+{
+struct parse_summary
+{
+    unsigned collections{};
+    unsigned end_collections{};
+    unsigned data_fields{};
+    std::size_t data_bits{};
+    std::size_t section_bytes{};
+    unsigned last_tlc{};
+
+    constexpr bool operator==(const parse_summary&) const = default;
+};
+
+/// @brief Records the handler calls, for comparing the parsers.
+template <typename TBase>
+struct summary_parser : public TBase
+{
+    using control = TBase::control;
+    using item_type = TBase::item_type;
+    using items_view_type = TBase::items_view_type;
+
+    constexpr summary_parser() = default;
+    constexpr ~summary_parser() override = default;
+
+    constexpr control parse_collection_begin([[maybe_unused]] main::collection_type collection,
+                                             [[maybe_unused]] const global_item_store& global_state,
+                                             const items_view_type& main_section,
+                                             unsigned tlc_number) override
+    {
+        summary.collections++;
+        summary.section_bytes += main_section.size();
+        summary.last_tlc = tlc_number;
+        return TBase::control::CONTINUE;
+    }
+    constexpr control parse_collection_end([[maybe_unused]] const global_item_store& global_state,
+                                           const items_view_type& main_section,
+                                           unsigned tlc_number) override
+    {
+        summary.end_collections++;
+        summary.section_bytes += main_section.size();
+        summary.last_tlc = tlc_number;
+        return (summary.end_collections == break_at) ? TBase::control::BREAK
+                                                     : TBase::control::CONTINUE;
+    }
+    constexpr control parse_report_data_field([[maybe_unused]] const item_type& main_item,
+                                              const global_item_store& global_state,
+                                              const items_view_type& main_section,
+                                              unsigned tlc_number) override
+    {
+        auto params = TBase::get_report_data_field_params(global_state);
+        summary.data_fields++;
+        summary.data_bits += params.size * params.count;
+        summary.section_bytes += main_section.size();
+        summary.last_tlc = tlc_number;
+        return TBase::control::CONTINUE;
+    }
+
+    parse_summary summary{};
+    unsigned break_at{};
+};
+
+template <typename TIterator>
+struct fixed_summary_parser : public summary_parser<parser<TIterator>>
+{
+    constexpr fixed_summary_parser(const descriptor_view_base<TIterator>& desc_view)
+    {
+        this->parse_items(desc_view);
+    }
+    constexpr ~fixed_summary_parser() override = default;
+};
+
+template <typename TIterator>
+struct deep_summary_parser : public summary_parser<parser<TIterator>>
+{
+    constexpr deep_summary_parser(const descriptor_view_base<TIterator>& desc_view,
+                                  std::span<global_item_store> global_stack)
+    {
+        this->parse_items(desc_view, global_stack);
+    }
+    constexpr ~deep_summary_parser() override = default;
+};
+
+template <typename TIterator>
+struct chunked_summary_parser : public summary_parser<stream_parser<TIterator>>
+{
+    constexpr chunked_summary_parser(std::span<const byte_type> data, std::size_t chunk_size,
+                                     unsigned stop_at = 0)
+    {
+        this->break_at = stop_at;
+        while (!data.empty())
+        {
+            auto size = std::min(chunk_size, data.size());
+            this->push(data.first(size));
+            data = data.subspan(size);
+        }
+        this->finish();
+    }
+    constexpr ~chunked_summary_parser() override = default;
+};
+
+constexpr auto composite_desc =
+    descriptor(hid::app::keyboard::app_report_descriptor<1>(), push_globals(),
+               hid::app::mouse::app_report_descriptor<2>(), pop_globals());
+} // namespace
+
+SUITE(stream_parser_)
+{
+    TEST_CASE("stream parser compile-time")
+    {
+        constexpr auto expected =
+            fixed_summary_parser<copy_iterator>(ce_descriptor_view(composite_desc)).summary;
+        static_assert(expected.collections == 3);
+        static_assert(expected.last_tlc == 2);
+        static_assert(chunked_summary_parser<copy_iterator>(composite_desc, 1).summary ==
+                      expected);
+        static_assert(chunked_summary_parser<copy_iterator>(composite_desc, 5).summary ==
+                      expected);
+        static_assert(chunked_summary_parser<copy_iterator>(composite_desc, 1, 1).stopped());
+    };
+
+    TEST_CASE("single pass parser")
+    {
+        constexpr auto nested_desc = descriptor(
+            push_globals(), push_globals(), push_globals(), push_globals(), push_globals(),
+            hid::app::mouse::app_report_descriptor<0>(), pop_globals(), pop_globals(),
+            pop_globals(), pop_globals(), pop_globals());
+        auto desc_view = descriptor_view(nested_desc);
+
+        // the default stack can't hold 5 pushed states
+        bool thrown = false;
+        try
+        {
+            fixed_summary_parser<reinterpret_iterator>{desc_view};
+        }
+        catch (const hid::rdf::exception&)
+        {
+            thrown = true;
+        }
+        CHECK(thrown);
+
+        std::array<global_item_store, 6> global_stack{};
+        auto deep = deep_summary_parser<reinterpret_iterator>(desc_view, global_stack);
+        CHECK(deep.summary.collections == 2);
+
+        // truncated item is detected during the parsing pass
+        thrown = false;
+        try
+        {
+            fixed_summary_parser<reinterpret_iterator>{descriptor_view(
+                std::span<const byte_type>(composite_desc).first(composite_desc.size() - 1))};
+        }
+        catch (const hid::rdf::exception&)
+        {
+            thrown = true;
+        }
+        CHECK(thrown);
+    };
+
+    TEST_CASE("stream parser runtime")
+    {
+        auto desc_view = descriptor_view(composite_desc);
+        auto expected = fixed_summary_parser<reinterpret_iterator>(desc_view).summary;
+        for (std::size_t chunk_size : {1, 2, 3, 7, 22, 64, 512})
+        {
+            auto streamed =
+                chunked_summary_parser<reinterpret_iterator>(composite_desc, chunk_size);
+            CHECK(streamed.summary == expected);
+            CHECK(not streamed.stopped());
+        }
+
+        // the data after the break isn't parsed
+        auto stopped = chunked_summary_parser<reinterpret_iterator>(composite_desc, 64, 1);
+        CHECK(stopped.stopped());
+        CHECK(stopped.summary.last_tlc == 1);
+
+        // incomplete last item
+        bool thrown = false;
+        try
+        {
+            chunked_summary_parser<reinterpret_iterator>(
+                std::span<const byte_type>(composite_desc).first(composite_desc.size() - 1), 8);
+        }
+        catch (const hid::rdf::exception&)
+        {
+            thrown = true;
+        }
+        CHECK(thrown);
+    };
+};